@@ -0,0 +1,132 @@
+"""Stand-in for FluidNC's telnet port, for exercising the raw TCP transport.
+
+Run on a PC on the same network as the display, then in FluidDash settings
+set the FluidNC host to the PC's address, the connection type to TCP and the
+telnet port to the one given here:
+
+    python scripts/fake_fluidnc.py --port 2323
+
+The server sends FluidNC's banner and then answers every '?' with a status
+report for a machine jogging X back and forth. Each reply is written in
+several small pieces with short gaps between them, so the reports arrive
+split at arbitrary points the way they do over WiFi. Other input lines get
+"ok". Options add line noise, oversized lines (LineAssembler must drop and
+count them) or a close after a number of reports (reconnect handling).
+
+Only the standard library is used. Port 23 needs root on most systems,
+hence the 2323 default.
+"""
+
+import argparse
+import random
+import socket
+import socketserver
+import time
+
+BANNER = "\r\nGrbl 3.7 [FluidNC v3.7.8 (fake) '$' for help]\r\n"
+NOISE = b"\x00\xff\x1b[?#~"
+
+
+class Machine:
+    """X moves between 0 and 100 mm at 1000 mm/min while jogging."""
+
+    def __init__(self):
+        self.start = time.monotonic()
+
+    def report(self):
+        elapsed = time.monotonic() - self.start
+        travel = (elapsed * 1000.0 / 60.0) % 200.0
+        x = travel if travel <= 100.0 else 200.0 - travel
+        return "<Jog|MPos:%.3f,0.000,-5.000,0.000|FS:1000,0|WCO:0.000,0.000,0.000>\r\n" % x
+
+
+class FakeFluidNC(socketserver.BaseRequestHandler):
+    def setup(self):
+        self.request.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.machine = Machine()
+        self.reports = 0
+        self.line = b""
+
+    def send_split(self, data):
+        opts = self.server.options
+        pos = 0
+        while pos < len(data):
+            size = random.randint(1, opts.max_chunk)
+            self.request.sendall(data[pos:pos + size])
+            pos += size
+            if opts.gap_ms:
+                time.sleep(random.uniform(0, opts.gap_ms) / 1000.0)
+
+    def reply_status(self):
+        opts = self.server.options
+        data = self.machine.report().encode()
+        if opts.noise and random.random() < opts.noise:
+            data = bytes(random.choice(NOISE) for _ in range(random.randint(1, 8))) + data
+        if opts.oversize and self.reports % opts.oversize == opts.oversize - 1:
+            data = b"[MSG:" + b"x" * 600 + b"]\r\n" + data
+        self.send_split(data)
+        self.reports += 1
+
+    def handle(self):
+        opts = self.server.options
+        peer = "%s:%d" % self.client_address
+        print("%s connected" % peer)
+        self.send_split(BANNER.encode())
+        try:
+            while True:
+                data = self.request.recv(256)
+                if not data:
+                    break
+                for byte in data:
+                    char = bytes([byte])
+                    if char == b"?":           # Realtime command, no newline
+                        self.reply_status()
+                    elif char in b"\r\n":
+                        if self.line.strip():
+                            self.send_split(b"ok\r\n")
+                        self.line = b""
+                    else:
+                        self.line += char
+                if opts.close_after and self.reports >= opts.close_after:
+                    print("%s closing after %d reports" % (peer, self.reports))
+                    break
+        except ConnectionError:
+            pass
+        print("%s disconnected after %d reports" % (peer, self.reports))
+
+
+class Server(socketserver.ThreadingTCPServer):
+    allow_reuse_address = True
+    daemon_threads = True
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Fake FluidNC telnet server")
+    parser.add_argument("--host", default="0.0.0.0")
+    parser.add_argument("--port", type=int, default=2323)
+    parser.add_argument("--max-chunk", type=int, default=12,
+                        help="largest piece a reply is written in (bytes)")
+    parser.add_argument("--gap-ms", type=float, default=5.0,
+                        help="longest pause between pieces")
+    parser.add_argument("--noise", type=float, default=0.0,
+                        help="chance of garbage bytes before a report (0-1)")
+    parser.add_argument("--oversize", type=int, default=0,
+                        help="send a line longer than LINE_ASSEMBLER_SIZE every N reports")
+    parser.add_argument("--close-after", type=int, default=0,
+                        help="drop the connection after N reports")
+    options = parser.parse_args()
+    if options.max_chunk < 1:
+        parser.error("--max-chunk must be at least 1")
+
+    server = Server((options.host, options.port), FakeFluidNC)
+    server.options = options
+    print("Fake FluidNC listening on %s:%d" % (options.host, options.port))
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    server.server_close()
+
+
+if __name__ == "__main__":
+    main()
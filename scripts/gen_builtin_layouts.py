@@ -0,0 +1,225 @@
+"""Compile layouts/*.json into flash-resident tables (src/display/builtin_layouts_gen.h).
+
+Runs as a PlatformIO pre-build step (extra_scripts in platformio.ini), or by
+hand: python scripts/gen_builtin_layouts.py
+
+Each layout is parsed with the same defaults and rules as the runtime parser
+(parseElement in src/display/screen_renderer.cpp). Element type and data
+source names are read from that file, so the two cannot drift apart. Layout
+problems the runtime would only log (unknown data source, too many
+elements) fail the build instead, as does a missing built-in for the DRO
+display mode's screen (DRO_SCREEN_PATH in src/config/config.h).
+"""
+
+import json
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+LAYOUT_DIR = os.path.join(PROJECT_DIR, "layouts")
+RENDERER = os.path.join(PROJECT_DIR, "src", "display", "screen_renderer.cpp")
+CONFIG = os.path.join(PROJECT_DIR, "src", "config", "config.h")
+OUTPUT = os.path.join(PROJECT_DIR, "src", "display", "builtin_layouts_gen.h")
+
+SCREEN_PATH = "/screens/%s.json"   # Where a user file overrides the built-in
+MAX_SCREEN_ELEMENTS = 60           # config.h
+LAYOUT_LABEL_MAX = 32              # config.h, NUL included
+
+VALUE_TYPES = ("ELEM_TEXT_DYNAMIC", "ELEM_TEMP_VALUE", "ELEM_COORD_VALUE", "ELEM_STATUS_VALUE")
+
+
+class LayoutError(Exception):
+    pass
+
+
+def read_name_tables():
+    with open(RENDERER, encoding="utf-8") as f:
+        source = f.read()
+    types = dict(re.findall(r'strcmp\(typeStr, "(\w+)"\) == 0\) return (ELEM_\w+);', source))
+    sources = dict(re.findall(r'\{"(\w+)", (DATA_\w+)\}', source))
+    if not types or not sources:
+        raise LayoutError("could not read element types / data sources from " + RENDERER)
+    return types, sources
+
+
+def read_required_paths():
+    """Screens the firmware shows without a user file - they must be built in."""
+    with open(CONFIG, encoding="utf-8") as f:
+        source = f.read()
+    paths = re.findall(r'#define DRO_SCREEN_PATH "([^"]+)"', source)
+    if not paths:
+        raise LayoutError("could not read DRO_SCREEN_PATH from " + CONFIG)
+    return paths
+
+
+def parse_color(text):
+    """parseColor() - including its treatment of 4-digit values as #RGB."""
+    if not isinstance(text, str) or len(text) < 4:
+        return 0x0000
+    hex_digits = text[1:] if text[0] == "#" else text
+    match = re.match(r"[0-9A-Fa-f]*", hex_digits)
+    color = int(match.group(0), 16) if match.group(0) else 0
+    color &= 0xFFFFFFFF
+    if len(hex_digits) == 4:
+        r = ((color >> 8) & 0xF) * 17
+        g = ((color >> 4) & 0xF) * 17
+        b = (color & 0xF) * 17
+    else:
+        r = (color >> 16) & 0xFF
+        g = (color >> 8) & 0xFF
+        b = color & 0xFF
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def parse_align(text):
+    return {"center": "ALIGN_CENTER", "right": "ALIGN_RIGHT"}.get(text, "ALIGN_LEFT")
+
+
+class StringTable:
+    """internString(): clipped to LAYOUT_LABEL_MAX - 1 bytes, duplicates shared."""
+
+    def __init__(self):
+        self.strings = []
+        self.offsets = {}
+        self.size = 0
+
+    def intern(self, text):
+        data = text.encode("utf-8")[:LAYOUT_LABEL_MAX - 1]
+        if data not in self.offsets:
+            self.offsets[data] = self.size
+            self.strings.append(data)
+            self.size += len(data) + 1
+        return self.offsets[data]
+
+
+def c_string(data):
+    out = ""
+    for byte in data:
+        char = chr(byte)
+        if char in "\\\"":
+            out += "\\" + char
+        elif 32 <= byte < 127 and char != "?":   # '?' - no trigraphs
+            out += char
+        else:
+            out += "\\%03o" % byte
+    return '"%s\\0"' % out
+
+
+def compile_layout(path, types, sources):
+    with open(path, encoding="utf-8") as f:
+        doc = json.load(f)
+
+    strings = StringTable()
+    name = strings.intern(doc.get("name", "Unnamed"))
+    background = parse_color(doc.get("background", "0000"))
+
+    elements = []
+    for index, elem in enumerate(doc.get("elements", [])):
+        elem_type = types.get(elem.get("type", "none"), "ELEM_NONE")
+        source_name = elem.get("data", "")
+        source = sources.get(source_name, "DATA_NONE")
+        if elem_type in VALUE_TYPES and source == "DATA_NONE":
+            raise LayoutError("%s: element %d: unknown data source '%s'" % (path, index, source_name))
+
+        elements.append((
+            elem_type,
+            source,
+            int(elem.get("size", 2)),
+            int(elem.get("decimals", 2)),
+            int(elem.get("x", 0)),
+            int(elem.get("y", 0)),
+            int(elem.get("w", 0)),
+            int(elem.get("h", 0)),
+            "0x%04X" % parse_color(elem.get("color", "FFFF")),
+            "0x%04X" % parse_color(elem.get("bgColor", "0000")),
+            strings.intern(elem.get("label", "")),
+            parse_align(elem.get("align", "left")),
+            "true" if elem.get("filled", True) else "false",
+            "true" if elem.get("showLabel", True) else "false",
+        ))
+
+    if not elements:
+        raise LayoutError("%s: no elements" % path)
+    if len(elements) > MAX_SCREEN_ELEMENTS:
+        raise LayoutError("%s: %d elements, max %d" % (path, len(elements), MAX_SCREEN_ELEMENTS))
+    return name, background, elements, strings
+
+
+def identifier(basename):
+    return "builtin" + "".join(part.capitalize() for part in re.split(r"[^0-9A-Za-z]+", basename) if part)
+
+
+def generate():
+    types, sources = read_name_tables()
+    files = sorted(f for f in os.listdir(LAYOUT_DIR) if f.endswith(".json")) if os.path.isdir(LAYOUT_DIR) else []
+
+    lines = [
+        "// Generated by scripts/gen_builtin_layouts.py from layouts/*.json - do not edit.",
+        "// Included by builtin_layouts.cpp only.",
+        "",
+        "#ifndef BUILTIN_LAYOUTS_GEN_H",
+        "#define BUILTIN_LAYOUTS_GEN_H",
+        "",
+        '#include "builtin_layouts.h"',
+        "",
+    ]
+    entries = []
+    paths = []
+    for filename in files:
+        basename = filename[:-len(".json")]
+        ident = identifier(basename)
+        name, background, elements, strings = compile_layout(os.path.join(LAYOUT_DIR, filename), types, sources)
+
+        lines.append("// ---------- layouts/%s ----------" % filename)
+        lines.append("")
+        lines.append("constexpr ScreenElement %sElements[] = {" % ident)
+        lines.append("    // type, source, size, decimals, x, y, w, h, color, bgColor, label, align, filled, showLabel")
+        for element in elements:
+            lines.append("    {%s}," % ", ".join(str(field) for field in element))
+        lines.append("};")
+        lines.append("")
+        lines.append("constexpr char %sStrings[] =" % ident)
+        for i, data in enumerate(strings.strings):
+            lines.append("    %s%s" % (c_string(data), ";" if i == len(strings.strings) - 1 else ""))
+        lines.append("")
+        paths.append(SCREEN_PATH % basename)
+        entries.append('    builtinLayout("%s", %sElements, %sStrings, %d, 0x%04X),'
+                       % (SCREEN_PATH % basename, ident, ident, name, background))
+
+    for path in read_required_paths():
+        if path not in paths:
+            raise LayoutError("no layouts/*.json for %s" % path)
+
+    lines.append("constexpr BuiltinLayout builtinLayoutTable[] = {")
+    if entries:
+        lines.extend(entries)
+    else:
+        lines.append("    {nullptr, nullptr, nullptr, 0, 0, 0, 0, 0},  // No layouts/*.json")
+    lines.append("};")
+    lines.append("")
+    lines.append("#endif // BUILTIN_LAYOUTS_GEN_H")
+    lines.append("")
+    output = "\n".join(lines)
+
+    # Only touch the header when it changes, so builds stay incremental
+    current = None
+    if os.path.exists(OUTPUT):
+        with open(OUTPUT, encoding="utf-8") as f:
+            current = f.read()
+    if current != output:
+        with open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+            f.write(output)
+        print("Built-in layouts: %d compiled into %s" % (len(entries), os.path.relpath(OUTPUT, PROJECT_DIR)))
+
+
+try:
+    generate()
+except (LayoutError, ValueError, OSError) as error:
+    print("Built-in layouts: %s" % error)
+    sys.exit(1)
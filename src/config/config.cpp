@@ -4,11 +4,8 @@
 // Define the global config instance
 Config cfg;
 
-// Define screen layouts
-ScreenLayout monitorLayout;
-ScreenLayout alignmentLayout;
-ScreenLayout graphLayout;
-ScreenLayout networkLayout;
+// Define the active screen layout
+ScreenLayout activeLayout = {nullptr, nullptr, 0, 0, 0, 0, 0, false, false};
 bool layoutsLoaded = false;
 
 // Preferences object - extern (defined in main.cpp)
@@ -21,6 +18,9 @@ void loadConfig() {
   strlcpy(cfg.fluidnc_ip, prefs.getString("fnc_ip", "192.168.73.13").c_str(), 16);
   cfg.fluidnc_port = prefs.getUShort("fnc_port", 81);  // FluidNC WebSocket default port
   cfg.fluidnc_auto_discover = prefs.getBool("fnc_auto", false);  // Disabled by default
+  cfg.fluidnc_transport = prefs.getUChar("fnc_transport", TRANSPORT_WEBSOCKET);
+  cfg.fluidnc_tcp_port = prefs.getUShort("fnc_tcpport", 23);  // FluidNC telnet default port
+  cfg.fluidnc_baud = prefs.getULong("fnc_baud", 115200);      // FluidNC console default
 
   cfg.temp_threshold_low = prefs.getFloat("temp_low", 30.0);
   cfg.temp_threshold_high = prefs.getFloat("temp_high", 50.0);
@@ -41,6 +41,7 @@ void loadConfig() {
   cfg.show_machine_coords = prefs.getBool("show_mpos", true);
   cfg.show_temp_graph = prefs.getBool("show_graph", true);
   cfg.coord_decimal_places = prefs.getUChar("coord_dec", 2);
+  cfg.show_link_stats = prefs.getBool("show_link", false);
 
   cfg.graph_timespan_seconds = prefs.getUShort("graph_time", 300);
   cfg.graph_update_interval = prefs.getUShort("graph_int", 5);
@@ -50,6 +51,8 @@ void loadConfig() {
 
   cfg.enable_logging = prefs.getBool("logging", true);
   cfg.status_update_rate = prefs.getUShort("status_rate", 200);
+  cfg.status_idle_rate = prefs.getUShort("status_idle", 2000);
+  cfg.fluidnc_auto_report = prefs.getBool("fnc_autorep", false);
 
   prefs.end();
 
@@ -63,6 +66,9 @@ void saveConfig() {
   prefs.putString("fnc_ip", cfg.fluidnc_ip);
   prefs.putUShort("fnc_port", cfg.fluidnc_port);
   prefs.putBool("fnc_auto", cfg.fluidnc_auto_discover);
+  prefs.putUChar("fnc_transport", cfg.fluidnc_transport);
+  prefs.putUShort("fnc_tcpport", cfg.fluidnc_tcp_port);
+  prefs.putULong("fnc_baud", cfg.fluidnc_baud);
 
   prefs.putFloat("temp_low", cfg.temp_threshold_low);
   prefs.putFloat("temp_high", cfg.temp_threshold_high);
@@ -83,6 +89,7 @@ void saveConfig() {
   prefs.putBool("show_mpos", cfg.show_machine_coords);
   prefs.putBool("show_graph", cfg.show_temp_graph);
   prefs.putUChar("coord_dec", cfg.coord_decimal_places);
+  prefs.putBool("show_link", cfg.show_link_stats);
 
   prefs.putUShort("graph_time", cfg.graph_timespan_seconds);
   prefs.putUShort("graph_int", cfg.graph_update_interval);
@@ -92,6 +99,8 @@ void saveConfig() {
 
   prefs.putBool("logging", cfg.enable_logging);
   prefs.putUShort("status_rate", cfg.status_update_rate);
+  prefs.putUShort("status_idle", cfg.status_idle_rate);
+  prefs.putBool("fnc_autorep", cfg.fluidnc_auto_report);
 
   prefs.end();
 
@@ -9,11 +9,20 @@ enum DisplayMode {
   MODE_ALIGNMENT,
   MODE_GRAPH,
   MODE_NETWORK,
-  MODE_STORAGE
+  MODE_STORAGE,
+  MODE_DRO,           // JSON layout (DRO_SCREEN_PATH)
+  MODE_COUNT
+};
+
+// FluidNC connection transport (cfg.fluidnc_transport)
+enum FluidNCTransportType : uint8_t {
+  TRANSPORT_WEBSOCKET = 0,    // ws://host:fluidnc_port/ws
+  TRANSPORT_TCP = 1,          // Raw telnet stream on fluidnc_tcp_port
+  TRANSPORT_UART = 2          // Wired serial console at fluidnc_baud
 };
 
 // Element types for JSON-defined screens
-enum ElementType {
+enum ElementType : uint8_t {
     ELEM_NONE = 0,
     ELEM_RECT,              // Filled or outline rectangle
     ELEM_LINE,              // Horizontal or vertical line
@@ -27,36 +36,97 @@ enum ElementType {
 };
 
 // Alignment options
-enum TextAlign {
+enum TextAlign : uint8_t {
     ALIGN_LEFT = 0,
     ALIGN_CENTER,
     ALIGN_RIGHT
 };
 
-// Screen element definition
+// Data sources for dynamic elements - resolved from the layout's "data"
+// string once by loadScreenConfig(), so drawing never compares strings
+enum DataSourceId : uint8_t {
+    DATA_NONE = 0,          // Unknown / not needed (static elements)
+
+    // Numeric
+    DATA_POS_X,
+    DATA_POS_Y,
+    DATA_POS_Z,
+    DATA_POS_A,
+    DATA_WPOS_X,
+    DATA_WPOS_Y,
+    DATA_WPOS_Z,
+    DATA_WPOS_A,
+    DATA_FEED_RATE,
+    DATA_SPINDLE_RPM,
+    DATA_PSU_VOLTAGE,
+    DATA_FAN_SPEED,
+    DATA_MACHINE_SUBSTATE,  // Hold/Door reason code (-1 when none)
+    DATA_TEMP0,
+    DATA_TEMP1,
+    DATA_TEMP2,
+    DATA_TEMP3,
+
+    // Text
+    DATA_MACHINE_STATE,
+    DATA_MACHINE_STATE_NAME,
+    DATA_IP_ADDRESS,
+    DATA_SSID,
+    DATA_DEVICE_NAME,
+    DATA_FLUIDNC_IP,
+
+    // RTC (text)
+    DATA_RTC_TIME,
+    DATA_RTC_TIME12,
+    DATA_RTC_TIME_SHORT,
+    DATA_RTC_DATE,
+    DATA_RTC_DATE_SHORT,
+    DATA_RTC_DATETIME
+};
+
+// What a layout's elements read beyond FluidNC/sensor values (ScreenLayout::frameNeeds)
+#define FRAME_NEEDS_RTC      0x01   // rtc* sources - one I2C read per frame
+#define FRAME_NEEDS_NETWORK  0x02   // ipAddress / ssid
+#define FRAME_NEEDS_SENSOR_NAMES 0x04   // Monitor row labels - sensor bus lock
+
+#define MAX_SCREEN_ELEMENTS 60
+
+// Screen element definition. Stored as-is in the compiled layout cache
+// (see display/layout_cache.h), so keep it free of pointers.
 struct ScreenElement {
     ElementType type;
+    DataSourceId source;     // Resolved from "data" (e.g., "wposX", "temp0")
+    uint8_t textSize;
+    uint8_t decimals;        // Decimal places for numeric values
     int16_t x, y, w, h;
     uint16_t color;
     uint16_t bgColor;
-    uint8_t textSize;
-    char label[32];          // For static text or prefix (e.g., "X:")
-    char dataSource[32];     // Data source identifier (e.g., "wposX", "temp0")
-    uint8_t decimals;        // Decimal places for numeric values
-    bool filled;             // For rectangles - filled or outline
+    uint16_t label;          // Static text or prefix (e.g., "X:") - string table offset
     TextAlign align;         // Text alignment
+    bool filled;             // For rectangles - filled or outline
     bool showLabel;          // Show label prefix
 };
 
-// Screen layout definition
+#define LAYOUT_LABEL_MAX 32  // Longest string kept from the JSON, NUL included
+
+// Screen layout definition. Elements and the string table shared by the
+// layout name and all labels live in one heap block sized to the layout -
+// or, for a built-in layout (display/builtin_layouts.h), in flash.
 struct ScreenLayout {
-    char name[32];
+    const ScreenElement* elements;  // elementCount entries; start of the heap block
+    const char* strings;        // NUL-separated, right after the elements
+    uint16_t stringBytes;
+    uint16_t name;              // String table offset
     uint16_t backgroundColor;
-    ScreenElement elements[60];  // Max 60 elements per screen
     uint8_t elementCount;
+    uint8_t frameNeeds;         // FRAME_NEEDS_* of its data sources
     bool isValid;
+    bool builtin;               // Points into flash - nothing to free
 };
 
+inline const char* layoutString(const ScreenLayout& layout, uint16_t offset) {
+    return layout.strings + offset;
+}
+
 // Configuration Structure
 struct Config {
   // Network
@@ -64,6 +134,9 @@ struct Config {
   char fluidnc_ip[16];
   uint16_t fluidnc_port;
   bool fluidnc_auto_discover;
+  uint8_t fluidnc_transport;     // FluidNCTransportType
+  uint16_t fluidnc_tcp_port;     // Telnet port for TRANSPORT_TCP
+  uint32_t fluidnc_baud;         // Baud rate for TRANSPORT_UART
 
   // Temperature - User Settings
   float temp_threshold_low;
@@ -90,6 +163,7 @@ struct Config {
   bool show_machine_coords;
   bool show_temp_graph;
   uint8_t coord_decimal_places;  // 2 or 3
+  bool show_link_stats;          // FluidNC link quality line on the Network screen
 
   // Graph Settings
   uint16_t graph_timespan_seconds;  // 60 to 3600 (1-60 minutes)
@@ -101,19 +175,21 @@ struct Config {
 
   // Advanced
   bool enable_logging;
-  uint16_t status_update_rate;  // FluidNC polling rate (ms)
+  uint16_t status_update_rate;  // FluidNC polling rate while moving (ms)
+  uint16_t status_idle_rate;    // FluidNC polling rate while idle/alarm (ms)
+  bool fluidnc_auto_report;     // Ask FluidNC to push reports ($Report/Interval)
 };
 
 // Global config instance (extern declaration)
 extern Config cfg;
 
-// Screen layouts (extern declarations)
-extern ScreenLayout monitorLayout;
-extern ScreenLayout alignmentLayout;
-extern ScreenLayout graphLayout;
-extern ScreenLayout networkLayout;
+// The one resident screen layout (loaded on demand, see loadScreenConfig)
+extern ScreenLayout activeLayout;
 extern bool layoutsLoaded;
 
+// Layout shown by MODE_DRO - loaded into activeLayout on first use
+#define DRO_SCREEN_PATH "/screens/dro.json"
+
 // Function declarations
 void loadConfig();
 void saveConfig();
@@ -29,6 +29,11 @@
 #define LED_GREEN   16
 #define LED_BLUE    17
 
+// FluidNC UART link (optional wired transport) - shares the green/blue LED
+// pins, which are also the ESP32's default UART2 pins
+#define FLUIDNC_UART_RX   16    // To FluidNC TX
+#define FLUIDNC_UART_TX   17    // To FluidNC RX
+
 // Mode button (use GPIO0 - BOOT button)
 #define BTN_MODE    0
 
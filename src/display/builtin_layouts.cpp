@@ -0,0 +1,21 @@
+#include "builtin_layouts.h"
+#include "builtin_layouts_gen.h"
+
+bool loadBuiltinLayout(const char* path, ScreenLayout& layout) {
+    for (size_t i = 0; i < sizeof(builtinLayoutTable) / sizeof(builtinLayoutTable[0]); i++) {
+        const BuiltinLayout& builtin = builtinLayoutTable[i];
+        if (builtin.path == nullptr || strcmp(builtin.path, path) != 0) continue;
+
+        layout.elements = builtin.elements;
+        layout.strings = builtin.strings;
+        layout.stringBytes = builtin.stringBytes;
+        layout.name = builtin.name;
+        layout.backgroundColor = builtin.backgroundColor;
+        layout.elementCount = builtin.elementCount;
+        layout.frameNeeds = builtin.frameNeeds;
+        layout.isValid = true;
+        layout.builtin = true;
+        return true;
+    }
+    return false;
+}
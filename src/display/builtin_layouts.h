@@ -0,0 +1,54 @@
+#ifndef BUILTIN_LAYOUTS_H
+#define BUILTIN_LAYOUTS_H
+
+#include <Arduino.h>
+#include "config/config.h"
+
+// ========== Built-in Layouts ==========
+// The JSON layouts in layouts/ are compiled by scripts/gen_builtin_layouts.py
+// (a PlatformIO pre-build step) into const element and string tables with
+// their data sources already bound - builtin_layouts_gen.h. The tables stay
+// in flash: a built-in screen costs no RAM and no parse time.
+//
+// loadScreenConfig() only falls back to a built-in layout when there is no
+// file at its path on SD or LittleFS, so a user's JSON still overrides it.
+// layouts/dro.json is the DRO display mode's screen (DRO_SCREEN_PATH); the
+// build fails without it, so that mode always has something to show.
+
+struct BuiltinLayout {
+    const char* path;                   // Where a user override would live, e.g. "/screens/dro.json"
+    const ScreenElement* elements;
+    const char* strings;
+    uint16_t stringBytes;
+    uint16_t name;                      // String table offset
+    uint16_t backgroundColor;
+    uint8_t elementCount;
+    uint8_t frameNeeds;
+};
+
+// Same rules as the runtime parser (parseElement in screen_renderer.cpp)
+constexpr uint8_t sourceFrameNeeds(DataSourceId source) {
+    return (source >= DATA_RTC_TIME && source <= DATA_RTC_DATETIME) ? FRAME_NEEDS_RTC :
+           (source == DATA_IP_ADDRESS || source == DATA_SSID) ? FRAME_NEEDS_NETWORK : 0;
+}
+
+template <size_t N>
+constexpr uint8_t elementsFrameNeeds(const ScreenElement (&elements)[N], size_t i = 0) {
+    return i < N ? sourceFrameNeeds(elements[i].source) | elementsFrameNeeds(elements, i + 1) : 0;
+}
+
+// One table entry; counts, sizes and frame needs come from the arrays.
+// 'strings' is a literal of NUL-separated strings - its own final NUL is
+// not part of the table.
+template <size_t N, size_t S>
+constexpr BuiltinLayout builtinLayout(const char* path, const ScreenElement (&elements)[N],
+                                      const char (&strings)[S], uint16_t name, uint16_t background) {
+    static_assert(N <= MAX_SCREEN_ELEMENTS, "Built-in layout has too many elements");
+    return BuiltinLayout{path, elements, strings, (uint16_t)(S - 1), name, background,
+                         (uint8_t)N, elementsFrameNeeds(elements)};
+}
+
+// Point 'layout' at the built-in copy of 'path'; false if there is none
+bool loadBuiltinLayout(const char* path, ScreenLayout& layout);
+
+#endif // BUILTIN_LAYOUTS_H
@@ -0,0 +1,41 @@
+// Generated by scripts/gen_builtin_layouts.py from layouts/*.json - do not edit.
+// Included by builtin_layouts.cpp only.
+
+#ifndef BUILTIN_LAYOUTS_GEN_H
+#define BUILTIN_LAYOUTS_GEN_H
+
+#include "builtin_layouts.h"
+
+// ---------- layouts/dro.json ----------
+
+constexpr ScreenElement builtinDroElements[] = {
+    // type, source, size, decimals, x, y, w, h, color, bgColor, label, align, filled, showLabel
+    {ELEM_RECT, DATA_NONE, 2, 2, 0, 0, 480, 30, 0x001F, 0x0000, 4, ALIGN_LEFT, true, true},
+    {ELEM_TEXT_STATIC, DATA_NONE, 2, 2, 10, 8, 0, 0, 0xFFFF, 0x0000, 5, ALIGN_LEFT, true, true},
+    {ELEM_TEXT_DYNAMIC, DATA_RTC_TIME_SHORT, 2, 2, 380, 8, 0, 0, 0xFFFF, 0x001F, 4, ALIGN_LEFT, true, true},
+    {ELEM_LINE, DATA_NONE, 2, 2, 0, 30, 480, 1, 0x4208, 0x0000, 4, ALIGN_LEFT, true, true},
+    {ELEM_COORD_VALUE, DATA_WPOS_X, 3, 3, 20, 45, 440, 55, 0x07FF, 0x0000, 19, ALIGN_LEFT, true, true},
+    {ELEM_COORD_VALUE, DATA_WPOS_Y, 3, 3, 20, 105, 440, 55, 0x07FF, 0x0000, 23, ALIGN_LEFT, true, true},
+    {ELEM_COORD_VALUE, DATA_WPOS_Z, 3, 3, 20, 165, 440, 55, 0x07FF, 0x0000, 27, ALIGN_LEFT, true, true},
+    {ELEM_LINE, DATA_NONE, 2, 2, 0, 235, 480, 1, 0x4208, 0x0000, 4, ALIGN_LEFT, true, true},
+    {ELEM_STATUS_VALUE, DATA_MACHINE_STATE, 1, 2, 20, 250, 220, 30, 0xFFFF, 0x0000, 31, ALIGN_LEFT, true, true},
+    {ELEM_TEXT_DYNAMIC, DATA_FEED_RATE, 1, 2, 240, 250, 220, 30, 0x8410, 0x0000, 39, ALIGN_RIGHT, true, true},
+    {ELEM_TEXT_DYNAMIC, DATA_IP_ADDRESS, 1, 2, 20, 295, 0, 0, 0x8410, 0x0000, 46, ALIGN_LEFT, true, true},
+};
+
+constexpr char builtinDroStrings[] =
+    "DRO\0"
+    "\0"
+    "FluidDash DRO\0"
+    "X: \0"
+    "Y: \0"
+    "Z: \0"
+    "State: \0"
+    "Feed: \0"
+    "IP: \0";
+
+constexpr BuiltinLayout builtinLayoutTable[] = {
+    builtinLayout("/screens/dro.json", builtinDroElements, builtinDroStrings, 0, 0x0000),
+};
+
+#endif // BUILTIN_LAYOUTS_GEN_H
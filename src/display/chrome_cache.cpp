@@ -0,0 +1,244 @@
+#include "chrome_cache.h"
+#include "ui_modes.h"
+#include "region_compositor.h"
+#include "render_profiler.h"
+#include "screen_renderer.h"
+
+ChromeCacheStats chromeCacheStats = {0, 0, 0, 0, 0};
+
+// Pixels as stored in sprite memory (byte-swapped RGB565)
+struct ChromeRun {
+    uint16_t count;
+    uint16_t color;
+};
+
+enum ChromeSlotState : uint8_t {
+    CHROME_EMPTY = 0,
+    CHROME_RENDERING,
+    CHROME_READY,
+    CHROME_FAILED               // Not retried until the key changes
+};
+
+struct ChromeSlot {
+    int8_t mode;                // -1 = unused
+    ChromeSlotState state;
+    uint8_t nextBand;
+    uint32_t key;
+    ChromeRun* runs;
+    uint16_t runCount;
+    uint16_t runCapacity;
+    uint16_t bandStart[CHROME_BANDS + 1];   // First run of each band
+};
+
+static ChromeSlot slots[CHROME_SLOTS] = {
+    {-1, CHROME_EMPTY, 0, 0, nullptr, 0, 0, {0}},
+    {-1, CHROME_EMPTY, 0, 0, nullptr, 0, 0, {0}},
+};
+static int8_t renderingSlot = -1;
+static int8_t shownSlot = -1;               // Pushed last - not reused while on screen
+static LGFX_Sprite scratch;
+static bool scratchReady = false;
+
+static const ChromeSource monitorChrome = {drawMonitorChrome, monitorChromeKey};
+static const ChromeSource alignmentChrome = {drawAlignmentChrome, alignmentChromeKey};
+static const ChromeSource graphChrome = {drawGraphChrome, graphChromeKey};
+
+static const ChromeSource* chromeSourceFor(DisplayMode mode) {
+    switch (mode) {
+        case MODE_MONITOR:   return &monitorChrome;
+        case MODE_ALIGNMENT: return &alignmentChrome;
+        case MODE_GRAPH:     return &graphChrome;
+        default:             return nullptr;
+    }
+}
+
+static int8_t findSlot(DisplayMode mode) {
+    for (int8_t i = 0; i < CHROME_SLOTS; i++) {
+        if (slots[i].mode == mode) return i;
+    }
+    return -1;
+}
+
+static void updateBytes() {
+    uint32_t bytes = 0;
+    for (uint8_t i = 0; i < CHROME_SLOTS; i++) {
+        bytes += (uint32_t)slots[i].runCapacity * sizeof(ChromeRun);
+    }
+    chromeCacheStats.bytes = bytes;
+}
+
+static void releaseScratch() {
+    if (scratchReady) {
+        scratch.deleteSprite();
+        scratchReady = false;
+    }
+}
+
+static void startRender(int8_t index, uint32_t key) {
+    if (renderingSlot >= 0 && renderingSlot != index) {
+        slots[renderingSlot].state = CHROME_EMPTY;  // Superseded, half done
+    }
+    ChromeSlot& slot = slots[index];
+    slot.state = CHROME_RENDERING;
+    slot.key = key;
+    slot.nextBand = 0;
+    slot.runCount = 0;
+    slot.bandStart[0] = 0;
+    renderingSlot = index;
+}
+
+static void abandonRender(ChromeSlot& slot) {
+    free(slot.runs);
+    slot.runs = nullptr;
+    slot.runCount = 0;
+    slot.runCapacity = 0;
+    slot.state = CHROME_FAILED;
+    renderingSlot = -1;
+    releaseScratch();
+    updateBytes();
+    chromeCacheStats.overflows++;
+}
+
+// ========== Pre-rendering ==========
+
+void prepareChrome(DisplayMode mode) {
+    const ChromeSource* source = chromeSourceFor(mode);
+    if (source == nullptr) return;
+
+    uint32_t key = source->key();
+    int8_t index = findSlot(mode);
+    if (index >= 0 && slots[index].key == key && slots[index].state != CHROME_EMPTY) {
+        return;  // Cached, being rendered, or known not to fit
+    }
+
+    if (index < 0) {
+        // Take a slot that is not on screen; unused ones first
+        for (int8_t i = 0; i < CHROME_SLOTS; i++) {
+            if (i == shownSlot) continue;
+            if (index < 0 || slots[i].mode < 0) index = i;
+        }
+    }
+    if (index < 0) return;
+
+    slots[index].mode = mode;
+    startRender(index, key);
+}
+
+bool serviceChromeCache() {
+    if (renderingSlot < 0) return false;
+    ChromeSlot& slot = slots[renderingSlot];
+    const ChromeSource* source = chromeSourceFor((DisplayMode)slot.mode);
+
+    // The chrome changed under us (e.g. a sensor renamed) - start over
+    uint32_t key = source->key();
+    if (key != slot.key) {
+        startRender(renderingSlot, key);
+    }
+
+    if (!scratchReady) {
+        scratch.setColorDepth(16);
+        if (scratch.createSprite(SCREEN_WIDTH, CHROME_BAND_ROWS) == nullptr) {
+            Serial.println("[Display] Chrome scratch sprite allocation failed");
+            abandonRender(slot);
+            return false;
+        }
+        scratchReady = true;
+    }
+
+    int16_t bandY = slot.nextBand * CHROME_BAND_ROWS;
+    FrameContext frame;
+    captureFrameContext(frame, CHROME_FRAME_NEEDS);
+    scratch.fillScreen(COLOR_BG);
+    source->draw(scratch, -bandY, frame);
+
+    // Count the runs first so the slot grows once per band
+    const uint16_t* pixels = (const uint16_t*)scratch.getBuffer();
+    const uint32_t pixelCount = (uint32_t)SCREEN_WIDTH * CHROME_BAND_ROWS;
+    uint32_t runs = 1;
+    for (uint32_t i = 1; i < pixelCount; i++) {
+        if (pixels[i] != pixels[i - 1]) runs++;
+    }
+
+    uint32_t needed = slot.runCount + runs;
+    if (needed * sizeof(ChromeRun) > CHROME_MAX_BYTES) {
+        Serial.printf("[Display] Chrome for %s exceeds %d bytes - drawn directly\n",
+                      perfModeName(slot.mode), CHROME_MAX_BYTES);
+        abandonRender(slot);
+        return false;
+    }
+    if (needed > slot.runCapacity) {
+        // Grow in 1 KB steps
+        uint16_t capacity = (uint16_t)min((needed + 255) & ~(uint32_t)255,
+                                          (uint32_t)(CHROME_MAX_BYTES / sizeof(ChromeRun)));
+        ChromeRun* grown = (ChromeRun*)realloc(slot.runs, capacity * sizeof(ChromeRun));
+        if (grown == nullptr) {
+            abandonRender(slot);
+            return false;
+        }
+        slot.runs = grown;
+        slot.runCapacity = capacity;
+        updateBytes();
+    }
+
+    ChromeRun* run = &slot.runs[slot.runCount];
+    run->count = 1;
+    run->color = pixels[0];
+    for (uint32_t i = 1; i < pixelCount; i++) {
+        if (pixels[i] == run->color) {
+            run->count++;
+        } else {
+            run++;
+            run->count = 1;
+            run->color = pixels[i];
+        }
+    }
+    slot.runCount = needed;
+    slot.nextBand++;
+    slot.bandStart[slot.nextBand] = slot.runCount;
+
+    if (slot.nextBand == CHROME_BANDS) {
+        slot.state = CHROME_READY;
+        renderingSlot = -1;
+        releaseScratch();
+        chromeCacheStats.renders++;
+    }
+    return true;
+}
+
+// ========== Mode Switch ==========
+
+bool pushChrome(DisplayMode mode) {
+    const ChromeSource* source = chromeSourceFor(mode);
+    if (source == nullptr) return false;
+
+    int8_t index = findSlot(mode);
+    if (index < 0 || slots[index].state != CHROME_READY || slots[index].key != source->key()) {
+        chromeCacheStats.misses++;
+        return false;
+    }
+    const ChromeSlot& slot = slots[index];
+
+    compositorBeginFrame();
+    for (uint8_t band = 0; band < CHROME_BANDS; band++) {
+        LGFX_Sprite* canvas = beginRegion(0, band * CHROME_BAND_ROWS, SCREEN_WIDTH, CHROME_BAND_ROWS, COLOR_BG);
+        if (canvas == nullptr) {
+            // No compositor buffers - only possible on the first band
+            compositorEndFrame();
+            chromeCacheStats.misses++;
+            return false;
+        }
+
+        uint16_t* out = (uint16_t*)canvas->getBuffer();
+        for (uint16_t r = slot.bandStart[band]; r < slot.bandStart[band + 1]; r++) {
+            for (uint16_t n = 0; n < slot.runs[r].count; n++) {
+                *out++ = slot.runs[r].color;
+            }
+        }
+        endRegion();
+    }
+    compositorEndFrame();
+
+    shownSlot = index;
+    chromeCacheStats.hits++;
+    return true;
+}
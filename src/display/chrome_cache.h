@@ -0,0 +1,63 @@
+#ifndef CHROME_CACHE_H
+#define CHROME_CACHE_H
+
+#include <Arduino.h>
+#include "display.h"
+#include "config/config.h"
+
+// ========== Screen Chrome Cache ==========
+// The static parts of a screen - header bar, titles, dividers, labels - are
+// rendered off-screen while the loop is idle, so switching to that screen
+// pushes them with DMA instead of clearing the panel and drawing them call
+// by call; only the values are drawn on top afterwards.
+//
+// A 480x320 RGB565 frame is 300 KB (no PSRAM), so the screen is rendered
+// CHROME_BAND_ROWS at a time into a scratch sprite and each band is kept as
+// (count, color) runs. Chrome is mostly flat color, which typically leaves
+// a few KB per screen. CHROME_SLOTS screens are kept: the one on the panel
+// and the one the footer tap leads to.
+//
+// Screens without fixed chrome (network, storage) have no source and are
+// always drawn directly.
+
+#define CHROME_SLOTS 2
+#define CHROME_BAND_ROWS 10                         // Scratch sprite: 480 x 10 px = 9.6 KB while rendering
+#define CHROME_BANDS (SCREEN_HEIGHT / CHROME_BAND_ROWS)
+#define CHROME_MAX_BYTES 16384                      // Per slot - busier chrome is drawn directly
+
+struct FrameContext;
+
+// Draw a screen's chrome onto 'dst' (panel or band sprite) over COLOR_BG;
+// 'dy' is added to every y coordinate. The cache renders from a
+// captureFrameContext(CHROME_FRAME_NEEDS) frame.
+typedef void (*ChromeDrawFn)(LovyanGFX& dst, int16_t dy, const FrameContext& frame);
+#define CHROME_FRAME_NEEDS FRAME_NEEDS_SENSOR_NAMES
+
+// Changes whenever the chrome would come out differently (labels, axis count)
+typedef uint32_t (*ChromeKeyFn)();
+
+struct ChromeSource {
+    ChromeDrawFn draw;
+    ChromeKeyFn key;
+};
+
+// Queue a screen for pre-rendering (no-op if it is cached and current)
+void prepareChrome(DisplayMode mode);
+
+// Render one band of the queued screen; false when there is nothing to do
+bool serviceChromeCache();
+
+// Push the cached chrome of 'mode' to the panel. False if it is not cached
+// (or stale) - the caller clears the screen and draws the chrome itself.
+bool pushChrome(DisplayMode mode);
+
+struct ChromeCacheStats {
+    uint32_t hits;              // Mode switches served from the cache
+    uint32_t misses;
+    uint32_t renders;           // Screens pre-rendered
+    uint32_t overflows;         // Gave up - over CHROME_MAX_BYTES or no scratch sprite
+    uint32_t bytes;             // Held by all slots
+};
+extern ChromeCacheStats chromeCacheStats;
+
+#endif // CHROME_CACHE_H
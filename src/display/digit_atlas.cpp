@@ -0,0 +1,151 @@
+#include "digit_atlas.h"
+#include "ui_layout.h"
+#include "display.h"
+
+// Glyph order in the atlas
+static const char ATLAS_CHARS[] = "0123456789-. \xF7" "CF";
+#define ATLAS_GLYPHS (sizeof(ATLAS_CHARS) - 1)
+
+// Text sizes rasterised - the large numeric fields of ui_layout.h
+static const uint8_t ATLAS_SIZES[] = {
+    AlignmentLayout::COORD_3AXIS_FONT_SIZE,
+    AlignmentLayout::COORD_4AXIS_FONT_SIZE,
+    MonitorLayout::TEMP_VALUE_FONT_SIZE,
+};
+#define ATLAS_SIZE_COUNT (sizeof(ATLAS_SIZES) / sizeof(ATLAS_SIZES[0]))
+
+// One vertical strip per size: glyph i occupies rows i*h .. i*h+h-1, so
+// each glyph is a contiguous run of byte-aligned 1-bit rows
+struct GlyphStrip {
+    uint8_t size;
+    uint8_t w, h;               // Glyph cell
+    uint16_t rowBytes;
+    LGFX_Sprite sprite;
+};
+
+static GlyphStrip strips[ATLAS_SIZE_COUNT];
+static bool atlasReady = false;
+
+bool initDigitAtlas() {
+    size_t bytes = 0;
+    for (uint8_t s = 0; s < ATLAS_SIZE_COUNT; s++) {
+        GlyphStrip& strip = strips[s];
+        strip.size = ATLAS_SIZES[s];
+        strip.w = 6 * strip.size;
+        strip.h = 8 * strip.size;
+        strip.rowBytes = (strip.w + 7) / 8;
+
+        strip.sprite.setPsram(false);
+        strip.sprite.setColorDepth(1);
+        if (strip.sprite.createSprite(strip.w, strip.h * ATLAS_GLYPHS) == nullptr) {
+            Serial.println("[Display] Digit atlas allocation failed - using text rendering");
+            for (uint8_t j = 0; j <= s; j++) {
+                strips[j].sprite.deleteSprite();
+            }
+            return false;
+        }
+        strip.sprite.createPalette();   // Draw with palette indices 0/1
+        strip.sprite.fillScreen(0);
+        strip.sprite.setFont(&fonts::Font0);
+        strip.sprite.setTextSize(strip.size);
+        strip.sprite.setTextColor(1, 0);
+        for (uint8_t g = 0; g < ATLAS_GLYPHS; g++) {
+            strip.sprite.drawChar((uint8_t)ATLAS_CHARS[g], 0, g * strip.h);
+        }
+        bytes += (size_t)strip.rowBytes * strip.h * ATLAS_GLYPHS;
+    }
+
+    atlasReady = true;
+    Serial.printf("[Display] Digit atlas: %u glyphs x %u sizes, %u bytes\n",
+                  (unsigned)ATLAS_GLYPHS, (unsigned)ATLAS_SIZE_COUNT, (unsigned)bytes);
+    return true;
+}
+
+static GlyphStrip* stripFor(uint8_t size) {
+    if (!atlasReady) return nullptr;
+    for (uint8_t s = 0; s < ATLAS_SIZE_COUNT; s++) {
+        if (strips[s].size == size) return &strips[s];
+    }
+    return nullptr;
+}
+
+static int glyphIndex(char c) {
+    const char* p = strchr(ATLAS_CHARS, c);
+    return (p != nullptr && c != '\0') ? p - ATLAS_CHARS : -1;
+}
+
+// ========== Fields ==========
+
+void initDigitField(DigitField& field, int16_t x, int16_t y, uint8_t size, uint16_t bg) {
+    field.x = x;
+    field.y = y;
+    field.size = size;
+    field.bg = bg;
+    resetDigitField(field);
+}
+
+void resetDigitField(DigitField& field) {
+    field.fg = field.bg;
+    memset(field.shown, 0, sizeof(field.shown));
+}
+
+static void drawCell(const DigitField& field, GlyphStrip* strip, uint8_t pos, char c, uint16_t fg) {
+    int cellW = 6 * field.size;
+    int cellH = 8 * field.size;
+    int x = field.x + pos * cellW;
+
+    int glyph = (strip != nullptr) ? glyphIndex(c) : -1;
+    if (glyph >= 0) {
+        const uint16_t palette[2] = {field.bg, fg};
+        const uint8_t* bits = (const uint8_t*)strip->sprite.getBuffer() +
+                              (size_t)glyph * strip->rowBytes * strip->h;
+        gfx.pushImage(x, field.y, strip->w, strip->h, bits, lgfx::palette_1bit, palette);
+        return;
+    }
+
+    // Not in the atlas - scaled text
+    gfx.fillRect(x, field.y, cellW, cellH, field.bg);
+    if (c != ' ' && c != '\0') {
+        gfx.setFont(&fonts::Font0);
+        gfx.setTextSize(field.size);
+        gfx.setTextColor(fg);
+        gfx.drawChar((uint8_t)c, x, field.y);
+    }
+}
+
+uint8_t drawDigits(DigitField& field, const char* text, uint16_t fg) {
+    return drawDigits(field, text, fg, gfx, 0);
+}
+
+uint8_t drawDigits(DigitField& field, const char* text, uint16_t fg, LovyanGFX& dst, int16_t dy) {
+    if (&dst != &gfx) {
+        // Atlas glyphs are the built-in font's cells - text with a background matches
+        dst.setFont(&fonts::Font0);
+        dst.setTextSize(field.size);
+        dst.setTextColor(fg, field.bg);
+        dst.drawString(text, field.x, field.y + dy);
+        return strlen(text);
+    }
+
+    GlyphStrip* strip = stripFor(field.size);
+    bool recolor = (fg != field.fg);
+    uint8_t drawn = 0;
+
+    gfx.startWrite();
+    size_t len = strlen(text);
+    for (uint8_t i = 0; i < DIGIT_FIELD_MAX; i++) {
+        char c = (i < len) ? text[i] : '\0';
+        char old = field.shown[i];
+        if (c == '\0' && old == '\0') break;       // Past both strings
+        if (c == old && !recolor) continue;
+
+        // A shorter string blanks the cells it no longer covers
+        drawCell(field, strip, i, c == '\0' ? ' ' : c, fg);
+        field.shown[i] = c;
+        drawn++;
+    }
+    gfx.endWrite();
+
+    field.fg = fg;
+    return drawn;
+}
@@ -0,0 +1,45 @@
+#ifndef DIGIT_ATLAS_H
+#define DIGIT_ATLAS_H
+
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+
+// ========== Digit Glyph Atlas ==========
+// The numeric glyphs (0-9 - . space, degree, C F) of the built-in 6x8 font
+// are rasterised once at boot, 1 bit per pixel, for each large text size
+// used in ui_layout.h. A DigitField remembers the characters on screen and
+// redraws only the cells that changed, each with a single pushImage from
+// the atlas (colors applied through a 2-entry palette) instead of scaled
+// glyph rendering.
+//
+// Atlas memory is ~4.6 KB for sizes 2, 4 and 5. Characters outside the
+// atlas, or every character if it could not be allocated, are drawn
+// with the regular text path.
+
+#define DIGIT_FIELD_MAX 12      // Characters per field
+#define DIGIT_DEGREE '\xF7'     // Degree sign in the built-in font
+
+// Rasterise the atlas - call once after gfx.init()
+bool initDigitAtlas();
+
+struct DigitField {
+    int16_t x, y;               // Top-left of the first character cell
+    uint8_t size;               // Text size (glyph cell is 6*size x 8*size)
+    uint16_t bg;
+    uint16_t fg;                // Color the shown characters were drawn in
+    char shown[DIGIT_FIELD_MAX + 1];
+};
+
+void initDigitField(DigitField& field, int16_t x, int16_t y, uint8_t size, uint16_t bg);
+
+// The area was cleared (full-screen redraw) - next drawDigits() draws all
+void resetDigitField(DigitField& field);
+
+// Show text, redrawing only changed cells; returns the cells drawn
+uint8_t drawDigits(DigitField& field, const char* text, uint16_t fg);
+
+// Same onto 'dst'. Any other target than the panel (a snapshot band, rows
+// -dy..) gets the same pixels as plain text, and the field is left as it was.
+uint8_t drawDigits(DigitField& field, const char* text, uint16_t fg, LovyanGFX& dst, int16_t dy);
+
+#endif // DIGIT_ATLAS_H
@@ -64,7 +64,7 @@ LGFX::LGFX(void)
     cfg.x_max = 3900;     // Right edge raw value
     cfg.y_min = 62000;    // Top edge raw value
     cfg.y_max = 65500;    // Bottom edge raw value
-    cfg.pin_int  = -1;           // No interrupt pin
+    cfg.pin_int  = TOUCH_IRQ;    // GPIO 36 - no SPI read while the pen is up
     cfg.pin_cs   = TOUCH_CS;     // GPIO 33
     cfg.pin_rst  = -1;           // No reset pin
     cfg.spi_host = HSPI_HOST;    // Same SPI bus as display
@@ -0,0 +1,133 @@
+#include "layout_cache.h"
+#include <LittleFS.h>
+
+uint32_t layoutSourceHash(const char* data, size_t length, uint32_t hash) {
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (uint8_t)data[i];
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+// "/screens/monitor.json" -> "/layouts/1a2b3c4d.bin", named from a hash of
+// the full path so /screens/dro.json and /sd/dro.json get separate caches.
+static void cachePath(const char* source, char* out, size_t size) {
+    uint32_t pathHash = layoutSourceHash(source, strlen(source));
+    snprintf(out, size, "%s/%08lx.bin", LAYOUT_CACHE_DIR, (unsigned long)pathHash);
+}
+
+uint32_t hashLayoutSource(Stream& input) {
+    char chunk[128];
+    uint32_t hash = LAYOUT_HASH_SEED;
+    size_t got;
+    while ((got = input.readBytes(chunk, sizeof(chunk))) > 0) {
+        hash = layoutSourceHash(chunk, got, hash);
+    }
+    return hash;
+}
+
+bool loadCachedLayout(const char* source, uint32_t hash, ScreenLayout& layout) {
+    char path[48];
+    cachePath(source, path, sizeof(path));
+    if (!LittleFS.exists(path)) {
+        return false;
+    }
+
+    File file = LittleFS.open(path, "r");
+    if (!file) {
+        return false;
+    }
+
+    LayoutFileHeader header;
+    if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        header.magic != LAYOUT_FILE_MAGIC ||
+        header.version != LAYOUT_FILE_VERSION ||
+        header.elementSize != sizeof(ScreenElement) ||
+        header.sourceHash != hash) {
+        file.close();
+        Serial.printf("[JSON] Cached %s is stale\n", path);
+        return false;
+    }
+
+    size_t elementBytes = (size_t)header.elementCount * sizeof(ScreenElement);
+    size_t dataBytes = elementBytes + header.stringBytes;
+    if (header.elementCount > MAX_SCREEN_ELEMENTS || header.stringBytes == 0 ||
+        file.size() != sizeof(header) + dataBytes) {
+        file.close();
+        Serial.printf("[JSON] Cached %s is corrupt\n", path);
+        return false;
+    }
+
+    uint8_t* data = (uint8_t*)malloc(dataBytes);
+    if (!data) {
+        file.close();
+        return false;
+    }
+    size_t got = file.read(data, dataBytes);
+    file.close();
+
+    // Every string offset must land inside a NUL-terminated table
+    const char* strings = (const char*)(data + elementBytes);
+    const ScreenElement* elements = (const ScreenElement*)data;
+    bool valid = got == dataBytes && strings[header.stringBytes - 1] == '\0' &&
+                 header.name < header.stringBytes;
+    for (uint8_t i = 0; valid && i < header.elementCount; i++) {
+        valid = elements[i].label < header.stringBytes;
+    }
+    if (!valid) {
+        free(data);
+        Serial.printf("[JSON] Cached %s is corrupt\n", path);
+        return false;
+    }
+
+    layout.elements = elements;
+    layout.strings = strings;
+    layout.stringBytes = header.stringBytes;
+    layout.name = header.name;
+    layout.backgroundColor = header.backgroundColor;
+    layout.elementCount = header.elementCount;
+    layout.frameNeeds = header.frameNeeds;
+    layout.isValid = true;
+    return true;
+}
+
+bool saveCachedLayout(const char* source, uint32_t hash, const ScreenLayout& layout) {
+    char path[48];
+    cachePath(source, path, sizeof(path));
+
+    if (!LittleFS.exists(LAYOUT_CACHE_DIR) && !LittleFS.mkdir(LAYOUT_CACHE_DIR)) {
+        Serial.println("[JSON] Failed to create " LAYOUT_CACHE_DIR);
+        return false;
+    }
+
+    File file = LittleFS.open(path, "w");
+    if (!file) {
+        Serial.printf("[JSON] Failed to open %s for writing\n", path);
+        return false;
+    }
+
+    LayoutFileHeader header;
+    header.magic = LAYOUT_FILE_MAGIC;
+    header.version = LAYOUT_FILE_VERSION;
+    header.elementSize = sizeof(ScreenElement);
+    header.sourceHash = hash;
+    header.backgroundColor = layout.backgroundColor;
+    header.elementCount = layout.elementCount;
+    header.frameNeeds = layout.frameNeeds;
+    header.stringBytes = layout.stringBytes;
+    header.name = layout.name;
+
+    // Elements and strings are one contiguous block (see loadScreenConfig)
+    size_t dataBytes = (size_t)layout.elementCount * sizeof(ScreenElement) + layout.stringBytes;
+    bool ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+              file.write((const uint8_t*)layout.elements, dataBytes) == dataBytes;
+    file.close();
+
+    if (!ok) {
+        Serial.printf("[JSON] Write error on %s\n", path);
+        LittleFS.remove(path);
+        return false;
+    }
+    Serial.printf("[JSON] Cached %s (%u bytes)\n", path, (unsigned)(sizeof(header) + dataBytes));
+    return true;
+}
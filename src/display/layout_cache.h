@@ -0,0 +1,48 @@
+#ifndef LAYOUT_CACHE_H
+#define LAYOUT_CACHE_H
+
+#include <Arduino.h>
+#include "config/config.h"
+
+// ========== Compiled Layout Cache ==========
+// A layout compiled from JSON is written to LittleFS as its in-memory image:
+//
+//   LayoutFileHeader | ScreenElement[elementCount] | string table
+//
+// The header records a hash of the JSON it was compiled from, so later boots
+// hash the JSON, find a matching .bin and read it straight into one heap
+// block - no ArduinoJson document is built. Any edit to the JSON (or a change
+// of ScreenElement) misses the cache and the layout is recompiled.
+
+#define LAYOUT_CACHE_DIR      "/layouts"
+#define LAYOUT_FILE_MAGIC     0x594C4446UL   // "FDLY"
+#define LAYOUT_FILE_VERSION   1
+
+struct LayoutFileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t elementSize;       // sizeof(ScreenElement) when written
+    uint32_t sourceHash;        // layoutSourceHash() of the JSON
+    uint16_t backgroundColor;
+    uint8_t elementCount;
+    uint8_t frameNeeds;
+    uint16_t stringBytes;
+    uint16_t name;              // Offset of the layout name in the string table
+};
+
+#define LAYOUT_HASH_SEED      2166136261UL
+
+// FNV-1a over the JSON text; chain calls by passing the previous result
+uint32_t layoutSourceHash(const char* data, size_t length, uint32_t hash = LAYOUT_HASH_SEED);
+
+// Hash everything left in the stream, in small chunks
+uint32_t hashLayoutSource(Stream& input);
+
+// Read the compiled copy of 'source' (a JSON path) if it was built from
+// JSON with this hash. On success 'layout' owns a new heap block.
+bool loadCachedLayout(const char* source, uint32_t hash, ScreenLayout& layout);
+
+// Write 'layout' as the compiled copy of 'source'
+bool saveCachedLayout(const char* source, uint32_t hash, const ScreenLayout& layout);
+
+#endif // LAYOUT_CACHE_H
@@ -0,0 +1,85 @@
+#include "motion_estimator.h"
+#include "state/global_state.h"
+
+struct MotionSample {
+    float pos[4];               // MPos X, Y, Z, A
+    unsigned long time;         // millis() when the report was parsed
+};
+
+static MotionSample lastSample;
+static uint32_t sampleReport = 0;       // fluidncView.reportCount of lastSample
+static uint32_t sampleVersion = 0;      // MPos version of lastSample
+static bool haveSample = false;
+static bool haveVelocity = false;
+static float velocity[4];               // units per ms
+static unsigned long sampleInterval = 0;
+
+static bool isMovingState(MachineState state) {
+    return state == MACHINE_RUN || state == MACHINE_JOG || state == MACHINE_HOME;
+}
+
+// ========== Sampling ==========
+
+void updateMotionEstimator() {
+    if (haveSample && fluidncView.reportCount == sampleReport) return;
+
+    MotionSample sample;
+    sample.pos[0] = fluidncView.posX;
+    sample.pos[1] = fluidncView.posY;
+    sample.pos[2] = fluidncView.posZ;
+    sample.pos[3] = fluidncView.posA;
+    sample.time = fluidncView.reportTime;
+    uint32_t version = fluidncVersionOf(fluidncView, FNC_CHG_MPOS);
+
+    // Any new report snaps the estimate back to it; a report whose MPos
+    // did not change means the axes are standing still
+    haveVelocity = false;
+    unsigned long dt = sample.time - lastSample.time;
+    if (haveSample && version != sampleVersion && dt > 0 && dt <= MOTION_SAMPLE_GAP_MAX) {
+        float speedSq = 0;
+        for (uint8_t i = 0; i < 4; i++) {
+            velocity[i] = (sample.pos[i] - lastSample.pos[i]) / dt;
+            speedSq += velocity[i] * velocity[i];
+        }
+
+        // Never run ahead of the commanded feed (units/min -> units/ms);
+        // two reports close together can otherwise fake a huge speed
+        float feedLimit = fluidncView.feedRate / 60000.0f;
+        float speed = sqrtf(speedSq);
+        if (feedLimit > 0 && speed > feedLimit) {
+            float scale = feedLimit / speed;
+            for (uint8_t i = 0; i < 4; i++) velocity[i] *= scale;
+        }
+
+        sampleInterval = dt;
+        haveVelocity = true;
+    }
+
+    lastSample = sample;
+    sampleReport = fluidncView.reportCount;
+    sampleVersion = version;
+    haveSample = true;
+}
+
+// ========== Estimate ==========
+
+bool estimateWorkPosition(float wpos[4]) {
+    wpos[0] = fluidncView.wposX;
+    wpos[1] = fluidncView.wposY;
+    wpos[2] = fluidncView.wposZ;
+    wpos[3] = fluidncView.wposA;
+
+    if (!haveVelocity || !isMovingState(fluidncView.machineState)) {
+        return false;
+    }
+
+    // Hold at the next expected report rather than overshoot a stop
+    unsigned long elapsed = millis() - lastSample.time;
+    unsigned long horizon = min(sampleInterval, (unsigned long)MOTION_EXTRAPOLATE_MAX);
+    if (elapsed > horizon) elapsed = horizon;
+
+    for (uint8_t i = 0; i < 4; i++) {
+        wpos[i] += velocity[i] * elapsed;
+    }
+    return elapsed > 0;
+}
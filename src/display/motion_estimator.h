@@ -0,0 +1,27 @@
+#ifndef MOTION_ESTIMATOR_H
+#define MOTION_ESTIMATOR_H
+
+#include <Arduino.h>
+
+// ========== DRO Motion Estimator ==========
+// Status reports arrive every 200 ms or slower, so the DRO digits step
+// during a jog. Between reports the work position is extrapolated from the
+// velocity of the last two MPos samples:
+//   - the velocity is clamped to the reported FS: feed rate
+//   - extrapolation stops after one report interval (max MOTION_EXTRAPOLATE_MAX)
+//   - only RUN / JOG / HOME are extrapolated
+// Every new report snaps the estimate back to the reported position, and a
+// report with an unchanged MPos stops the extrapolation.
+// Runs on core 1 from fluidncView; nothing here touches the network.
+
+#define DRO_UPDATE_INTERVAL       40     // ms between DRO redraws (25 Hz)
+#define MOTION_EXTRAPOLATE_MAX    500    // ms past the last report
+#define MOTION_SAMPLE_GAP_MAX     1000   // ms; older sample pairs give no velocity
+
+// Take in a new MPos sample if fluidncView has one (cheap, call per frame)
+void updateMotionEstimator();
+
+// Work position (X, Y, Z, A) at render time. Returns true while extrapolating.
+bool estimateWorkPosition(float wpos[4]);
+
+#endif // MOTION_ESTIMATOR_H
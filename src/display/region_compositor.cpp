@@ -0,0 +1,103 @@
+#include "region_compositor.h"
+#include <esp_heap_caps.h>
+
+CompositorStats compositorStats = {0, 0, 0};
+
+static uint16_t* buffers[COMPOSITOR_BUFFERS] = {nullptr};
+static uint8_t nextBuffer = 0;
+static LGFX_Sprite canvas(&gfx);
+static bool inFrame = false;
+
+// Region being rendered by beginRegion()/endRegion()
+static int16_t regionX, regionY, regionW, regionH;
+static bool regionOpen = false;
+
+bool initCompositor() {
+    for (uint8_t i = 0; i < COMPOSITOR_BUFFERS; i++) {
+        buffers[i] = (uint16_t*)heap_caps_malloc(COMPOSITOR_MAX_PIXELS * sizeof(uint16_t),
+                                                 MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        if (buffers[i] == nullptr) {
+            Serial.printf("[Display] Compositor buffer %u allocation failed - drawing directly\n", i);
+            for (uint8_t j = 0; j < i; j++) {
+                free(buffers[j]);
+                buffers[j] = nullptr;
+            }
+            return false;
+        }
+    }
+    Serial.printf("[Display] Compositor: %d x %u bytes DMA buffers\n",
+                  COMPOSITOR_BUFFERS, (unsigned)(COMPOSITOR_MAX_PIXELS * sizeof(uint16_t)));
+    return true;
+}
+
+void compositorBeginFrame() {
+    if (inFrame) return;
+    gfx.startWrite();
+    inFrame = true;
+}
+
+void compositorEndFrame() {
+    if (!inFrame) return;
+    gfx.waitDMA();
+    gfx.endWrite();
+    inFrame = false;
+}
+
+LGFX_Sprite* beginRegion(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bg) {
+    if (buffers[0] == nullptr || w <= 0 || h <= 0 ||
+        (uint32_t)w * h > COMPOSITOR_MAX_PIXELS) {
+        compositorStats.fallbacks++;
+        return nullptr;
+    }
+
+    // Each push waits for the transfer before it, so the buffer used two
+    // regions ago has finished and can be overwritten. Without an open
+    // frame nothing is queued, but wait anyway for safety.
+    if (!inFrame) gfx.waitDMA();
+
+    canvas.setBuffer(buffers[nextBuffer], w, h, lgfx::rgb565_2Byte);
+    canvas.fillScreen(bg);
+
+    regionX = x;
+    regionY = y;
+    regionW = w;
+    regionH = h;
+    regionOpen = true;
+    return &canvas;
+}
+
+void endRegion() {
+    if (!regionOpen) return;
+    regionOpen = false;
+
+    // Sprite memory is byte-swapped RGB565, the panel's wire format
+    bool ownFrame = !inFrame;
+    if (ownFrame) compositorBeginFrame();
+    gfx.pushImageDMA(regionX, regionY, regionW, regionH,
+                     (const lgfx::swap565_t*)buffers[nextBuffer]);
+    if (ownFrame) compositorEndFrame();
+
+    nextBuffer = (nextBuffer + 1) % COMPOSITOR_BUFFERS;
+    compositorStats.regions++;
+    compositorStats.pixels += (uint32_t)regionW * regionH;
+}
+
+void compositeText(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bg,
+                   int16_t textX, int16_t textY, uint8_t textSize,
+                   uint16_t color, const char* text) {
+    LGFX_Sprite* region = beginRegion(x, y, w, h, bg);
+    if (region == nullptr) {
+        gfx.fillRect(x, y, w, h, bg);
+        gfx.setTextSize(textSize);
+        gfx.setTextColor(color);
+        gfx.setCursor(x + textX, y + textY);
+        gfx.print(text);
+        return;
+    }
+
+    region->setTextSize(textSize);
+    region->setTextColor(color);
+    region->setCursor(textX, textY);
+    region->print(text);
+    endRegion();
+}
@@ -0,0 +1,49 @@
+#ifndef REGION_COMPOSITOR_H
+#define REGION_COMPOSITOR_H
+
+#include <Arduino.h>
+#include "display.h"
+
+// ========== Region Compositor ==========
+// Dirty regions are rendered into a small RAM sprite (background and text in
+// one pass) and pushed to the panel with DMA, so each pixel crosses the SPI
+// bus once and there is no clear-then-draw flicker. Two buffers ping-pong:
+// the CPU renders the next region while the previous one is still being
+// transferred.
+//
+// Memory budget (internal RAM, no PSRAM): COMPOSITOR_BUFFERS x
+// COMPOSITOR_MAX_PIXELS x 2 bytes = ~21 KB. A region larger than the budget,
+// or any region if the buffers could not be allocated, is drawn directly
+// (fillRect + text) instead.
+
+#define COMPOSITOR_BUFFERS 2
+#define COMPOSITOR_MAX_PIXELS 5280      // 210x25 header clock is the largest region
+
+// Allocate the DMA buffers - call once after gfx.init()
+bool initCompositor();
+
+// Bracket a batch of regions: holds the SPI bus for the DMA transfers and
+// waits for the last one before releasing it (touch shares the bus)
+void compositorBeginFrame();
+void compositorEndFrame();
+
+// Render a region off-screen. Coordinates inside the region are relative to
+// its top-left corner. Returns nullptr if it cannot be composited - the
+// caller must then draw it directly.
+LGFX_Sprite* beginRegion(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bg);
+void endRegion();       // Queue the region for DMA
+
+// One line of classic-font text in a cleared box; the text starts at
+// (textX, textY) relative to the box. Falls back to direct drawing.
+void compositeText(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bg,
+                   int16_t textX, int16_t textY, uint8_t textSize,
+                   uint16_t color, const char* text);
+
+struct CompositorStats {
+    uint32_t regions;       // Pushed with DMA
+    uint32_t fallbacks;     // Drawn directly (over budget / no buffers)
+    uint32_t pixels;        // Sent by composited regions
+};
+extern CompositorStats compositorStats;
+
+#endif // REGION_COMPOSITOR_H
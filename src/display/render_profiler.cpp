@@ -0,0 +1,118 @@
+#include "render_profiler.h"
+#include "region_compositor.h"
+#include "screen_renderer.h"
+#include "ui_modes.h"
+
+#define PERF_OVERLAY_W 132
+#define PERF_OVERLAY_H 10
+
+// External variables from main.cpp
+extern DisplayMode currentMode;
+
+RenderProfile renderProfile;
+
+static unsigned long frameStartUs = 0;
+static uint64_t framePixelsStart = 0;
+static bool overlayEnabled = false;
+static unsigned long lastOverlayDraw = 0;
+
+// Pixels sent so far by the counted paths
+static uint64_t pixelsSent() {
+    return renderStats.pixelsSentTotal + compositorStats.pixels;
+}
+
+// ========== Frame Timing ==========
+
+void perfBeginFrame() {
+    framePixelsStart = pixelsSent();
+    frameStartUs = micros();
+}
+
+void perfEndFrame(DisplayMode mode, PerfKind kind) {
+    uint32_t us = micros() - frameStartUs;
+    if (mode >= PERF_MODES) return;
+
+    PerfWindow& window = renderProfile.modes[mode][kind];
+    window.samples[window.next] = us;
+    window.next = (window.next + 1) % PERF_WINDOW;
+    if (window.count < PERF_WINDOW) window.count++;
+    window.calls++;
+    if (us > window.maxUs) window.maxUs = us;
+
+    window.lastPixels = (uint32_t)(pixelsSent() - framePixelsStart);
+    window.totalPixels += window.lastPixels;
+}
+
+void perfResetElements(uint8_t count) {
+    memset(renderProfile.elements, 0, sizeof(renderProfile.elements));
+    renderProfile.elementCount = count;
+}
+
+void perfRecordElement(uint8_t index, uint32_t us) {
+    if (index >= MAX_SCREEN_ELEMENTS) return;
+    ElementPerf& elem = renderProfile.elements[index];
+    elem.lastUs = us;
+    if (us > elem.maxUs) elem.maxUs = us;
+    elem.draws++;
+}
+
+uint32_t perfPercentile(const PerfWindow& window, uint8_t pct) {
+    uint8_t count = window.count;
+    if (count == 0) return 0;
+
+    // Sorted copy - the window is small and this only runs on request
+    uint32_t sorted[PERF_WINDOW];
+    memcpy(sorted, window.samples, count * sizeof(uint32_t));
+    for (uint8_t i = 1; i < count; i++) {
+        uint32_t value = sorted[i];
+        uint8_t j = i;
+        while (j > 0 && sorted[j - 1] > value) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = value;
+    }
+    return sorted[(count - 1) * min(pct, (uint8_t)100) / 100];
+}
+
+const char* perfModeName(uint8_t mode) {
+    static const char* const names[PERF_MODES] = {
+        "monitor", "alignment", "graph", "network", "storage", "dro"
+    };
+    return mode < PERF_MODES ? names[mode] : "unknown";
+}
+
+// ========== Overlay ==========
+
+bool perfOverlayEnabled() {
+    return overlayEnabled;
+}
+
+void togglePerfOverlay() {
+    overlayEnabled = !overlayEnabled;
+    Serial.printf("[Display] Performance overlay %s\n", overlayEnabled ? "on" : "off");
+    if (overlayEnabled) {
+        drawPerfOverlay(currentMode, true);
+    } else {
+        drawScreen();  // Repaint what the overlay covered
+    }
+}
+
+void drawPerfOverlay(DisplayMode mode, bool force) {
+    if (!overlayEnabled || mode >= PERF_MODES) return;
+    if (!force && millis() - lastOverlayDraw < PERF_OVERLAY_INTERVAL) return;
+    lastOverlayDraw = millis();
+
+    // "U 1.2/4.5ms 12.3kB": update p50/p95 and the last update's SPI bytes
+    const PerfWindow& window = renderProfile.modes[mode][PERF_UPDATE];
+    char text[24];
+    snprintf(text, sizeof(text), "U %.1f/%.1fms %.1fkB",
+             perfPercentile(window, 50) / 1000.0f,
+             perfPercentile(window, 95) / 1000.0f,
+             window.lastPixels * 2 / 1024.0f);
+
+    compositorBeginFrame();
+    compositeText(SCREEN_WIDTH - PERF_OVERLAY_W, SCREEN_HEIGHT - PERF_OVERLAY_H,
+                  PERF_OVERLAY_W, PERF_OVERLAY_H, COLOR_BG, 2, 1, 1, COLOR_WARN, text);
+    compositorEndFrame();
+}
@@ -0,0 +1,74 @@
+#ifndef RENDER_PROFILER_H
+#define RENDER_PROFILER_H
+
+#include <Arduino.h>
+#include "config/config.h"
+
+// ========== Render Profiler ==========
+// Times every drawScreen() call and every updateDisplay() pass that drew
+// something, per display mode (that time is exactly how long loop() was
+// held up), and the pixels it sent. Each mode keeps a rolling window of
+// recent timings for percentiles, and JSON layouts also record per-element
+// draw times.
+//
+// Pixels are counted by the layout renderer and the region compositor;
+// anything a mode draws with direct gfx calls is timed but not counted.
+// SPI bytes = pixels x 2 (RGB565), command overhead excluded.
+
+#define PERF_WINDOW 64          // Timings kept per mode and kind
+#define PERF_MODES MODE_COUNT   // DisplayMode values
+
+enum PerfKind : uint8_t {
+    PERF_DRAW = 0,              // Full redraw (drawScreen)
+    PERF_UPDATE,                // Periodic refresh (updateDisplay)
+    PERF_KINDS
+};
+
+struct PerfWindow {
+    uint32_t samples[PERF_WINDOW];  // us, ring
+    uint8_t next;
+    uint8_t count;
+    uint32_t calls;
+    uint32_t maxUs;                 // Since reset
+    uint32_t lastPixels;
+    uint64_t totalPixels;
+};
+
+struct ElementPerf {
+    uint32_t lastUs;
+    uint32_t maxUs;
+    uint32_t draws;
+};
+
+struct RenderProfile {
+    PerfWindow modes[PERF_MODES][PERF_KINDS];
+    ElementPerf elements[MAX_SCREEN_ELEMENTS];
+    uint8_t elementCount;           // Of the layout drawn last
+};
+extern RenderProfile renderProfile;
+
+// Bracket one drawScreen()/updateDisplay() call
+void perfBeginFrame();
+void perfEndFrame(DisplayMode mode, PerfKind kind);
+
+// JSON layouts: a full redraw starts a fresh set of element timings
+void perfResetElements(uint8_t count);
+void perfRecordElement(uint8_t index, uint32_t us);
+
+// pct 0-100 over the rolling window; 0 if nothing recorded yet
+uint32_t perfPercentile(const PerfWindow& window, uint8_t pct);
+
+const char* perfModeName(uint8_t mode);
+
+// ========== Overlay ==========
+// Small corner readout of the current mode's update time and last frame's
+// SPI traffic, refreshed at most every PERF_OVERLAY_INTERVAL ms while enabled
+// (force after a full redraw has painted over it).
+
+#define PERF_OVERLAY_INTERVAL 1000
+
+bool perfOverlayEnabled();
+void togglePerfOverlay();       // Off -> the screen is redrawn to clear it
+void drawPerfOverlay(DisplayMode mode, bool force = false);
+
+#endif // RENDER_PROFILER_H
@@ -0,0 +1,59 @@
+#include "render_scheduler.h"
+
+RenderSchedulerStats renderSchedulerStats = {0, 0, 0};
+
+static RenderField* activeFields = nullptr;
+static uint8_t activeCount = 0;
+static uint8_t nextField = 0;           // Where the next pass starts
+static uint32_t generation = 0;         // Bumped whenever the table changes
+
+void setRenderFields(RenderField* fields, uint8_t count) {
+    unsigned long now = millis();
+    for (uint8_t i = 0; i < count; i++) {
+        fields[i].lastDraw = now;
+        fields[i].seen = fields[i].version ? fields[i].version() : 0;
+    }
+    activeFields = fields;
+    activeCount = min(count, (uint8_t)RENDER_MAX_FIELDS);
+    nextField = 0;
+    generation++;
+}
+
+uint8_t serviceRenderFields() {
+    if (activeFields == nullptr || activeCount == 0) return 0;
+
+    unsigned long start = micros();
+    unsigned long now = millis();
+    uint32_t startGeneration = generation;
+    uint8_t first = nextField;
+    uint8_t drawn = 0;
+
+    for (uint8_t n = 0; n < activeCount; n++) {
+        uint8_t i = (first + n) % activeCount;
+        RenderField& field = activeFields[i];
+
+        if (now - field.lastDraw < field.periodMs) continue;
+        uint32_t version = field.version ? field.version() : 0;
+        if (field.version && version == field.seen) continue;
+
+        if (drawn > 0 && micros() - start >= RENDER_BUDGET_US) {
+            // Out of budget - this field goes first next pass
+            renderSchedulerStats.deferred++;
+            nextField = i;
+            break;
+        }
+
+        field.seen = version;
+        field.lastDraw = now;
+        field.draw();
+        drawn++;
+
+        if (generation != startGeneration) break;  // draw() redrew the screen
+    }
+
+    if (drawn > 0) {
+        renderSchedulerStats.passes++;
+        renderSchedulerStats.fieldsDrawn += drawn;
+    }
+    return drawn;
+}
@@ -0,0 +1,46 @@
+#ifndef RENDER_SCHEDULER_H
+#define RENDER_SCHEDULER_H
+
+#include <Arduino.h>
+
+// ========== Render Scheduler ==========
+// Each screen registers its dynamic fields after its full redraw. A field
+// repaints when its period has elapsed AND (if it has one) its version
+// function returns something new - e.g. DRO digits every 40 ms, the clock
+// once a second, temperatures when a DS18B20 reading lands, coordinates
+// when a report moves them (at most ~15 Hz).
+//
+// serviceRenderFields() runs every loop() pass but stops starting new
+// fields once RENDER_BUDGET_US of drawing has been spent; the next pass
+// resumes with the first field it skipped, so every field gets its turn.
+
+#define RENDER_BUDGET_US 8000           // Drawing per loop() pass (at least one field)
+#define RENDER_MAX_FIELDS 12
+
+typedef uint32_t (*RenderVersionFn)();
+typedef void (*RenderDrawFn)();
+
+struct RenderField {
+    const char* name;
+    uint16_t periodMs;          // Minimum time between repaints
+    RenderVersionFn version;    // nullptr = repaint every period
+    RenderDrawFn draw;
+    unsigned long lastDraw;     // Scheduler state
+    uint32_t seen;              // version() when last drawn
+};
+
+// Install the current screen's fields. Call right after the screen was
+// fully drawn - the fields start out as up to date.
+void setRenderFields(RenderField* fields, uint8_t count);
+
+// Repaint due fields within the budget; returns the number drawn
+uint8_t serviceRenderFields();
+
+struct RenderSchedulerStats {
+    uint32_t passes;            // serviceRenderFields() calls that drew something
+    uint32_t fieldsDrawn;
+    uint32_t deferred;          // Due fields left for the next pass (budget spent)
+};
+extern RenderSchedulerStats renderSchedulerStats;
+
+#endif // RENDER_SCHEDULER_H
@@ -1,27 +1,20 @@
 #include "screen_renderer.h"
 #include "display.h"
+#include "temp_graph.h"
+#include "layout_cache.h"
+#include "builtin_layouts.h"
+#include "render_profiler.h"
+#include "screen_snapshot.h"
+#include "sensors/sensors.h"
 #include <WiFi.h>
 #include <SD.h>
 #include <ArduinoJson.h>
 #include <RTClib.h>
 #include "../storage_manager.h"
+#include "state/global_state.h"
 
-// External variables from main.cpp (needed for data access)
-extern bool sdCardAvailable;
-extern StorageManager storage;
-extern float temperatures[4];
-extern float posX, posY, posZ, posA;
-extern float wposX, wposY, wposZ, wposA;
-extern int feedRate;
-extern int spindleRPM;
-extern float psuVoltage;
-extern uint8_t fanSpeed;
-extern String machineState;
-extern RTC_DS3231 rtc;
-extern bool rtcAvailable;
-extern float *tempHistory;
-extern uint16_t historySize;
-extern uint16_t historyIndex;
+// Layout whose elements the retained renderer has cached (see below)
+static const ScreenLayout* cachedLayout = nullptr;
 
 // ========== JSON PARSING FUNCTIONS ==========
 
@@ -74,34 +67,149 @@ TextAlign parseAlignment(const char* alignStr) {
     return ALIGN_LEFT;
 }
 
-// Load screen configuration from JSON file
-bool loadScreenConfig(const char* filename, ScreenLayout& layout) {
-    Serial.printf("[JSON] Loading screen config: %s\n", filename);
+// Add a string to the layout's string table (identical strings are shared).
+// pool has room for every string the layout can hold, so this cannot overflow.
+static uint16_t internString(char* pool, uint16_t& used, const char* text) {
+    char clipped[LAYOUT_LABEL_MAX];
+    strlcpy(clipped, text, sizeof(clipped));
 
-    // Use StorageManager to load file (auto-fallback SD->SPIFFS)
-    String jsonContent = storage.loadFile(filename);
+    for (uint16_t offset = 0; offset < used; offset += strlen(pool + offset) + 1) {
+        if (strcmp(pool + offset, clipped) == 0) return offset;
+    }
+    uint16_t offset = used;
+    used += strlcpy(pool + offset, clipped, sizeof(clipped)) + 1;
+    return offset;
+}
 
-    if (jsonContent.length() == 0) {
-        Serial.printf("[JSON] File not found: %s\n", filename);
-        return false;
+// Fields the renderer uses - everything else in a layout is skipped unread
+static void buildLayoutFilters(JsonDocument& header, JsonDocument& element) {
+    header["name"] = true;
+    header["background"] = true;
+
+    static const char* const fields[] = {
+        "type", "x", "y", "w", "h", "color", "bgColor", "size",
+        "decimals", "filled", "showLabel", "align", "label", "data"
+    };
+    for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+        element[fields[i]] = true;
     }
+}
 
-    if (jsonContent.length() > 8192) {
-        Serial.printf("[JSON] File too large: %d bytes (max 8192)\n", jsonContent.length());
+// Fill one element; false if it has to be dropped
+static bool parseElement(JsonObject elem, ScreenElement& se, uint8_t& frameNeeds,
+                         char* pool, uint16_t& poolUsed) {
+    // Parse element properties
+    se.type = parseElementType(elem["type"] | "none");
+    se.x = elem["x"] | 0;
+    se.y = elem["y"] | 0;
+    se.w = elem["w"] | 0;
+    se.h = elem["h"] | 0;
+    se.color = parseColor(elem["color"] | "FFFF");
+    se.bgColor = parseColor(elem["bgColor"] | "0000");
+    se.textSize = elem["size"] | 2;
+    se.decimals = elem["decimals"] | 2;
+    se.filled = elem["filled"] | true;
+    se.showLabel = elem["showLabel"] | true;
+    se.align = parseAlignment(elem["align"] | "left");
+
+    // Bind the data source now - value elements without a known one are dropped
+    const char* source = elem["data"] | "";
+    se.source = parseDataSource(source);
+    bool needsData = se.type == ELEM_TEXT_DYNAMIC || se.type == ELEM_TEMP_VALUE ||
+                     se.type == ELEM_COORD_VALUE || se.type == ELEM_STATUS_VALUE;
+    if (needsData && se.source == DATA_NONE) {
+        Serial.printf("[JSON] Unknown data source '%s' - element skipped\n", source);
         return false;
     }
+    if (se.source >= DATA_RTC_TIME && se.source <= DATA_RTC_DATETIME) {
+        frameNeeds |= FRAME_NEEDS_RTC;
+    } else if (se.source == DATA_IP_ADDRESS || se.source == DATA_SSID) {
+        frameNeeds |= FRAME_NEEDS_NETWORK;
+    }
 
-    Serial.printf("[JSON] Loaded %d bytes from %s (%s)\n",
-                  jsonContent.length(), filename, storage.getStorageType(filename).c_str());
+    se.label = internString(pool, poolUsed, elem["label"] | "");
+    return true;
+}
 
-    // CRITICAL: Yield before JSON parsing (prevents mutex deadlock)
-    yield();
+static int skipJsonWhitespace(Stream& in) {
+    int next = in.peek();
+    while (next == ' ' || next == '\n' || next == '\r' || next == '\t') {
+        in.read();
+        next = in.peek();
+    }
+    return next;
+}
+
+// Position the stream at the value of a key of the top-level object.
+// Walks the JSON tokens (strings, nesting) so a label or nested object
+// containing the same text is never mistaken for the key.
+static bool seekTopLevelKey(Stream& in, const char* key) {
+    size_t keyLen = strlen(key);
+    int depth = 0;
+    bool expectKey = false;     // At depth 1: the next string is a key
+
+    int c;
+    while ((c = in.read()) >= 0) {
+        if (c == '"') {
+            // Read the string, comparing it with 'key' as it goes
+            size_t len = 0;
+            bool match = (depth == 1 && expectKey);
+            while ((c = in.read()) >= 0 && c != '"') {
+                if (c == '\\') {
+                    in.read();          // Escaped character - never part of our keys
+                    match = false;
+                    continue;
+                }
+                if (len >= keyLen || key[len] != c) match = false;
+                len++;
+            }
+            if (c < 0) return false;
+            if (match && len == keyLen) {
+                if (skipJsonWhitespace(in) != ':') return false;
+                in.read();
+                skipJsonWhitespace(in);
+                return true;
+            }
+            continue;
+        }
+
+        switch (c) {
+            case '{':
+            case '[':
+                depth++;
+                expectKey = (c == '{' && depth == 1);
+                break;
+            case '}':
+            case ']':
+                depth--;
+                break;
+            case ',':
+                if (depth == 1) expectKey = true;
+                break;
+            case ':':
+                if (depth == 1) expectKey = false;
+                break;
+            default:
+                break;
+        }
+    }
+    return false;
+}
+
+// Build a layout from a JSON stream into a single block sized for it.
+// The file is read twice - once for the top-level fields, once walking the
+// "elements" array one element at a time - so only one element is ever
+// held in a JsonDocument, whatever the size of the file.
+static bool compileScreenLayout(File& file, ScreenLayout& layout) {
+    JsonDocument headerFilter;
+    JsonDocument elementFilter;
+    buildLayoutFilters(headerFilter, elementFilter);
 
-    // Parse JSON - use heap allocation to avoid stack issues
     JsonDocument doc;
 
     yield();  // Yield before deserialize
-    DeserializationError error = deserializeJson(doc, jsonContent);
+    DeserializationError error = deserializeJson(doc, file,
+                                                 DeserializationOption::Filter(headerFilter));
     yield();  // Yield after deserialize
 
     if (error) {
@@ -109,429 +217,552 @@ bool loadScreenConfig(const char* filename, ScreenLayout& layout) {
         return false;
     }
 
+    // Worst case: name plus one distinct label per element
+    size_t elementBytes = MAX_SCREEN_ELEMENTS * sizeof(ScreenElement);
+    size_t poolBytes = (MAX_SCREEN_ELEMENTS + 1) * LAYOUT_LABEL_MAX;
+    uint8_t* data = (uint8_t*)malloc(elementBytes + poolBytes);
+    if (!data) {
+        Serial.println("[JSON] Out of memory for layout");
+        return false;
+    }
+    ScreenElement* elems = (ScreenElement*)data;
+    char* pool = (char*)(data + elementBytes);
+    uint16_t poolUsed = 0;
+
     // Extract layout info
-    strncpy(layout.name, doc["name"] | "Unnamed", sizeof(layout.name) - 1);
+    layout.name = internString(pool, poolUsed, doc["name"] | "Unnamed");
     layout.backgroundColor = parseColor(doc["background"] | "0000");
-    layout.elementCount = 0;
-    layout.isValid = false;
+    layout.frameNeeds = 0;
 
-    // Parse elements array
-    JsonArray elements = doc["elements"].as<JsonArray>();
-    if (!elements) {
+    // Position the stream just inside the top-level elements array
+    file.seek(0);
+    if (!seekTopLevelKey(file, "elements") || file.read() != '[') {
         Serial.println("[JSON] No elements array found");
+        free(data);
         return false;
     }
 
-    int elementIndex = 0;
-    for (JsonObject elem : elements) {
-        if (elementIndex >= 60) {
-            Serial.println("[JSON] Warning: Max 60 elements, ignoring rest");
+    uint8_t elementIndex = 0;
+    while (true) {
+        // Skip whitespace to spot an empty array / trailing ']'
+        int next = skipJsonWhitespace(file);
+        if (next == ']' || next < 0) break;
+
+        if (elementIndex >= MAX_SCREEN_ELEMENTS) {
+            Serial.printf("[JSON] Warning: Max %d elements, ignoring rest\n", MAX_SCREEN_ELEMENTS);
             break;
         }
 
         yield();  // Yield during element parsing loop
 
-        ScreenElement& se = layout.elements[elementIndex];
-
-        // Parse element properties
-        se.type = parseElementType(elem["type"] | "none");
-        se.x = elem["x"] | 0;
-        se.y = elem["y"] | 0;
-        se.w = elem["w"] | 0;
-        se.h = elem["h"] | 0;
-        se.color = parseColor(elem["color"] | "FFFF");
-        se.bgColor = parseColor(elem["bgColor"] | "0000");
-        se.textSize = elem["size"] | 2;
-        se.decimals = elem["decimals"] | 2;
-        se.filled = elem["filled"] | true;
-        se.showLabel = elem["showLabel"] | true;
-        se.align = parseAlignment(elem["align"] | "left");
+        error = deserializeJson(doc, file, DeserializationOption::Filter(elementFilter));
+        if (error) {
+            Serial.printf("[JSON] Parse error in element %d: %s\n", elementIndex, error.c_str());
+            free(data);
+            return false;
+        }
 
-        // Copy strings
-        strncpy(se.label, elem["label"] | "", sizeof(se.label) - 1);
-        strncpy(se.dataSource, elem["data"] | "", sizeof(se.dataSource) - 1);
+        if (parseElement(doc.as<JsonObject>(), elems[elementIndex], layout.frameNeeds,
+                         pool, poolUsed)) {
+            elementIndex++;
+        }
 
-        elementIndex++;
+        if (!file.findUntil(",", "]")) break;  // ']' - end of the array
     }
 
-    yield();  // Final yield after parsing complete
+    // Close the gap after the last element and give back the unused pool
+    size_t usedElementBytes = elementIndex * sizeof(ScreenElement);
+    memmove(data + usedElementBytes, pool, poolUsed);
+    uint8_t* shrunk = (uint8_t*)realloc(data, usedElementBytes + poolUsed);
+    if (shrunk) data = shrunk;
 
+    layout.elements = (ScreenElement*)data;
+    layout.strings = (const char*)(data + usedElementBytes);
+    layout.stringBytes = poolUsed;
     layout.elementCount = elementIndex;
     layout.isValid = true;
-
-    Serial.printf("[JSON] Loaded %d elements from %s\n", elementIndex, layout.name);
     return true;
 }
 
-// Initialize default/fallback layouts in case JSON files are missing
-void initDefaultLayouts() {
-    // Mark all layouts as invalid initially
-    monitorLayout.isValid = false;
-    alignmentLayout.isValid = false;
-    graphLayout.isValid = false;
-    networkLayout.isValid = false;
+// Load screen configuration: the compiled copy in LittleFS when it matches
+// the JSON, otherwise parse the JSON and cache the result
+bool loadScreenConfig(const char* filename, ScreenLayout& layout) {
+    Serial.printf("[JSON] Loading screen config: %s\n", filename);
+
+    freeScreenLayout(layout);  // Only one copy of a layout is ever resident
+
+    // Use StorageManager to open the file (auto-fallback SD->SPIFFS)
+    File file = storage.openFile(filename);
+
+    if (!file) {
+        // No user file - the copy compiled into the firmware, if there is one
+        if (loadBuiltinLayout(filename, layout)) {
+            Serial.printf("[JSON] Using built-in %s (%d elements, in flash)\n",
+                          layoutString(layout, layout.name), layout.elementCount);
+            return true;
+        }
+        Serial.printf("[JSON] File not found: %s\n", filename);
+        return false;
+    }
+
+    Serial.printf("[JSON] Opened %u bytes from %s (%s)\n",
+                  (unsigned)file.size(), filename, storage.getStorageType(filename).c_str());
+
+    uint32_t hash = hashLayoutSource(file);
+    if (loadCachedLayout(filename, hash, layout)) {
+        file.close();
+        Serial.printf("[JSON] Loaded %d elements from %s (cached)\n",
+                      layout.elementCount, layoutString(layout, layout.name));
+        return true;
+    }
+
+    // CRITICAL: Yield before JSON parsing (prevents mutex deadlock)
+    yield();
+
+    file.seek(0);
+    bool compiled = compileScreenLayout(file, layout);
+    file.close();
+    if (!compiled) {
+        return false;
+    }
+    yield();  // Final yield after parsing complete
 
-    strcpy(monitorLayout.name, "Monitor (Fallback)");
-    strcpy(alignmentLayout.name, "Alignment (Fallback)");
-    strcpy(graphLayout.name, "Graph (Fallback)");
-    strcpy(networkLayout.name, "Network (Fallback)");
+    Serial.printf("[JSON] Loaded %d elements from %s (%u bytes)\n",
+                  layout.elementCount, layoutString(layout, layout.name),
+                  (unsigned)(layout.elementCount * sizeof(ScreenElement) + layout.stringBytes));
 
+    saveCachedLayout(filename, hash, layout);
+    return true;
+}
+
+void freeScreenLayout(ScreenLayout& layout) {
+    if (&layout == cachedLayout) {
+        invalidateScreenLayout();  // Elements are about to change under the cache
+    }
+    if (!layout.builtin) {
+        free((void*)layout.elements);
+    }
+    layout.elements = nullptr;
+    layout.builtin = false;
+    layout.strings = nullptr;
+    layout.stringBytes = 0;
+    layout.elementCount = 0;
+    layout.isValid = false;
+}
+
+// No layout resident until a screen asks for one
+void initDefaultLayouts() {
+    freeScreenLayout(activeLayout);
     Serial.println("[JSON] Default layouts initialized (fallback mode)");
 }
 
 // ========== DATA ACCESS FUNCTIONS ==========
 
-// Get numeric data value from data source identifier
-float getDataValue(const char* dataSource) {
-    if (strcmp(dataSource, "posX") == 0) return posX;
-    if (strcmp(dataSource, "posY") == 0) return posY;
-    if (strcmp(dataSource, "posZ") == 0) return posZ;
-    if (strcmp(dataSource, "posA") == 0) return posA;
+// Layout "data" names, only looked up while loading
+struct DataSourceName {
+    const char* name;
+    DataSourceId id;
+};
+
+static const DataSourceName dataSourceNames[] = {
+    {"posX", DATA_POS_X},
+    {"posY", DATA_POS_Y},
+    {"posZ", DATA_POS_Z},
+    {"posA", DATA_POS_A},
+    {"wposX", DATA_WPOS_X},
+    {"wposY", DATA_WPOS_Y},
+    {"wposZ", DATA_WPOS_Z},
+    {"wposA", DATA_WPOS_A},
+    {"feedRate", DATA_FEED_RATE},
+    {"spindleRPM", DATA_SPINDLE_RPM},
+    {"psuVoltage", DATA_PSU_VOLTAGE},
+    {"fanSpeed", DATA_FAN_SPEED},
+    {"machineSubstate", DATA_MACHINE_SUBSTATE},
+    {"temp0", DATA_TEMP0},
+    {"temp1", DATA_TEMP1},
+    {"temp2", DATA_TEMP2},
+    {"temp3", DATA_TEMP3},
+    {"machineState", DATA_MACHINE_STATE},
+    {"machineStateName", DATA_MACHINE_STATE_NAME},
+    {"ipAddress", DATA_IP_ADDRESS},
+    {"ssid", DATA_SSID},
+    {"deviceName", DATA_DEVICE_NAME},
+    {"fluidncIP", DATA_FLUIDNC_IP},
+    {"rtcTime", DATA_RTC_TIME},
+    {"rtcTime12", DATA_RTC_TIME12},
+    {"rtcTimeShort", DATA_RTC_TIME_SHORT},
+    {"rtcDate", DATA_RTC_DATE},
+    {"rtcDateShort", DATA_RTC_DATE_SHORT},
+    {"rtcDateTime", DATA_RTC_DATETIME},
+};
+
+// Resolve a data source name; DATA_NONE if unknown
+DataSourceId parseDataSource(const char* name) {
+    for (size_t i = 0; i < sizeof(dataSourceNames) / sizeof(dataSourceNames[0]); i++) {
+        if (strcmp(name, dataSourceNames[i].name) == 0) return dataSourceNames[i].id;
+    }
+    return DATA_NONE;
+}
+
+// Values both captures share
+static void fillFrameContext(FrameContext& frame, uint8_t needs,
+                             const FluidNCState& fnc, const SensorState& sensorState) {
+    frame.connected = fnc.connected;
+    frame.machineState = fnc.machineState;
+    frame.machineSubstate = fnc.machineSubstate;
+    memcpy(frame.stateText, fnc.stateText, sizeof(frame.stateText));
+    frame.pos[0] = fnc.posX;
+    frame.pos[1] = fnc.posY;
+    frame.pos[2] = fnc.posZ;
+    frame.pos[3] = fnc.posA;
+    frame.wpos[0] = fnc.wposX;
+    frame.wpos[1] = fnc.wposY;
+    frame.wpos[2] = fnc.wposZ;
+    frame.wpos[3] = fnc.wposA;
+    frame.feedRate = fnc.feedRate;
+    frame.spindleRPM = fnc.spindleRPM;
+
+    memcpy(frame.temperatures, sensorState.temperatures, sizeof(frame.temperatures));
+    memcpy(frame.peakTemps, sensorState.peakTemps, sizeof(frame.peakTemps));
+    frame.psuVoltage = sensorState.psuVoltage;
+    frame.fanSpeed = sensorState.fanSpeed;
+    frame.fanRPM = sensorState.fanRPM;
+
+    frame.ipAddress[0] = '\0';
+    frame.ssid[0] = '\0';
+    if (needs & FRAME_NEEDS_NETWORK) {
+        strlcpy(frame.ipAddress, WiFi.localIP().toString().c_str(), sizeof(frame.ipAddress));
+        strlcpy(frame.ssid, WiFi.SSID().c_str(), sizeof(frame.ssid));
+    }
+
+    frame.rtcValid = false;
+    frame.history = nullptr;
+}
 
-    if (strcmp(dataSource, "wposX") == 0) return wposX;
-    if (strcmp(dataSource, "wposY") == 0) return wposY;
-    if (strcmp(dataSource, "wposZ") == 0) return wposZ;
-    if (strcmp(dataSource, "wposA") == 0) return wposA;
+// Caller holds the sensor bus lock (sensorMappings)
+static void readSensorNames(char names[4][13]) {
+    static const char* const defaultNames[] = {"X", "YL", "YR", "Z"};
+    for (int pos = 0; pos < 4; pos++) {
+        const SensorMapping* sensor = getSensorMappingByPosition(pos);
+        strlcpy(names[pos], sensor ? sensor->friendlyName : defaultNames[pos], sizeof(names[pos]));
+    }
+}
 
-    if (strcmp(dataSource, "feedRate") == 0) return feedRate;
-    if (strcmp(dataSource, "spindleRPM") == 0) return spindleRPM;
-    if (strcmp(dataSource, "psuVoltage") == 0) return psuVoltage;
-    if (strcmp(dataSource, "fanSpeed") == 0) return fanSpeed;
+void captureFrameContext(FrameContext& frame, uint8_t needs) {
+    fillFrameContext(frame, needs, fluidncView, sensors);
 
-    if (strcmp(dataSource, "temp0") == 0) return temperatures[0];
-    if (strcmp(dataSource, "temp1") == 0) return temperatures[1];
-    if (strcmp(dataSource, "temp2") == 0) return temperatures[2];
-    if (strcmp(dataSource, "temp3") == 0) return temperatures[3];
+    if (needs & FRAME_NEEDS_SENSOR_NAMES) {
+        // Web handlers on core 0 can hold the bus lock for a whole OneWire
+        // search - only try it, and keep the names we have if it is busy
+        static char names[4][13] = {"X", "YL", "YR", "Z"};
+        SensorBusLock busLock(0);
+        if (busLock.locked()) {
+            readSensorNames(names);
+        }
+        memcpy(frame.sensorNames, names, sizeof(frame.sensorNames));
+    }
 
-    return 0.0f;
+    if ((needs & FRAME_NEEDS_RTC) && network.rtcAvailable) {
+        frame.now = rtc.now();
+        frame.rtcValid = true;
+    }
 }
 
-// Get string data value from data source identifier
-String getDataString(const char* dataSource) {
-    if (strcmp(dataSource, "machineState") == 0) return machineState;
-    if (strcmp(dataSource, "ipAddress") == 0) return WiFi.localIP().toString();
-    if (strcmp(dataSource, "ssid") == 0) return WiFi.SSID();
-    if (strcmp(dataSource, "deviceName") == 0) return String(cfg.device_name);
-    if (strcmp(dataSource, "fluidncIP") == 0) return String(cfg.fluidnc_ip);
+void captureSnapshotFrame(FrameContext& frame, uint8_t needs, TempHistoryCopy* history) {
+    fillFrameContext(frame, needs, fluidnc, sensorsView);
+
+    if (needs & FRAME_NEEDS_SENSOR_NAMES) {
+        SensorBusLock busLock;
+        readSensorNames(frame.sensorNames);
+    }
+
+    if ((needs & FRAME_NEEDS_RTC) && network.rtcAvailable) {
+        frame.now = SNAPSHOT_CLOCK;
+        frame.rtcValid = true;
+    }
+    frame.history = history;
+}
+
+// Get numeric data value
+float getDataValue(const FrameContext& frame, DataSourceId source) {
+    switch (source) {
+        case DATA_POS_X:            return frame.pos[0];
+        case DATA_POS_Y:            return frame.pos[1];
+        case DATA_POS_Z:            return frame.pos[2];
+        case DATA_POS_A:            return frame.pos[3];
+        case DATA_WPOS_X:           return frame.wpos[0];
+        case DATA_WPOS_Y:           return frame.wpos[1];
+        case DATA_WPOS_Z:           return frame.wpos[2];
+        case DATA_WPOS_A:           return frame.wpos[3];
+        case DATA_FEED_RATE:        return frame.feedRate;
+        case DATA_SPINDLE_RPM:      return frame.spindleRPM;
+        case DATA_PSU_VOLTAGE:      return frame.psuVoltage;
+        case DATA_FAN_SPEED:        return frame.fanSpeed;
+        case DATA_MACHINE_SUBSTATE: return frame.machineSubstate;
+        case DATA_TEMP0:            return frame.temperatures[0];
+        case DATA_TEMP1:            return frame.temperatures[1];
+        case DATA_TEMP2:            return frame.temperatures[2];
+        case DATA_TEMP3:            return frame.temperatures[3];
+        default:                    return 0.0f;
+    }
+}
+
+// Format any data source as text
+void getDataString(const FrameContext& frame, DataSourceId source, char* out, size_t size) {
+    switch (source) {
+        case DATA_MACHINE_STATE:
+            strlcpy(out, frame.stateText, size);
+            return;
+        case DATA_MACHINE_STATE_NAME:
+            strlcpy(out, machineStateName(frame.machineState), size);
+            return;
+        case DATA_IP_ADDRESS:
+            strlcpy(out, frame.ipAddress, size);
+            return;
+        case DATA_SSID:
+            strlcpy(out, frame.ssid, size);
+            return;
+        case DATA_DEVICE_NAME:
+            strlcpy(out, cfg.device_name, size);
+            return;
+        case DATA_FLUIDNC_IP:
+            strlcpy(out, cfg.fluidnc_ip, size);
+            return;
+        default:
+            break;
+    }
 
     // RTC date/time data sources
-    if (rtcAvailable) {
-        DateTime now = rtc.now();
-        char buffer[32];
-
-        if (strcmp(dataSource, "rtcTime") == 0) {
-            // Format: HH:MM:SS
-            sprintf(buffer, "%02d:%02d:%02d", now.hour(), now.minute(), now.second());
-            return String(buffer);
-        }
-        if (strcmp(dataSource, "rtcTime12") == 0) {
-            // Format: HH:MM:SS AM/PM
-            int hour12 = now.hour() % 12;
-            if (hour12 == 0) hour12 = 12;
-            sprintf(buffer, "%02d:%02d:%02d %s", hour12, now.minute(), now.second(),
-                    now.hour() >= 12 ? "PM" : "AM");
-            return String(buffer);
-        }
-        if (strcmp(dataSource, "rtcTimeShort") == 0) {
-            // Format: HH:MM
-            sprintf(buffer, "%02d:%02d", now.hour(), now.minute());
-            return String(buffer);
+    if (source >= DATA_RTC_TIME && source <= DATA_RTC_DATETIME) {
+        if (!frame.rtcValid) {
+            strlcpy(out, "No RTC", size);
+            return;
         }
-        if (strcmp(dataSource, "rtcDate") == 0) {
-            // Format: YYYY-MM-DD
-            sprintf(buffer, "%04d-%02d-%02d", now.year(), now.month(), now.day());
-            return String(buffer);
-        }
-        if (strcmp(dataSource, "rtcDateShort") == 0) {
-            // Format: MM/DD/YYYY
-            sprintf(buffer, "%02d/%02d/%04d", now.month(), now.day(), now.year());
-            return String(buffer);
-        }
-        if (strcmp(dataSource, "rtcDateTime") == 0) {
-            // Format: YYYY-MM-DD HH:MM:SS
-            sprintf(buffer, "%04d-%02d-%02d %02d:%02d:%02d",
-                    now.year(), now.month(), now.day(),
-                    now.hour(), now.minute(), now.second());
-            return String(buffer);
-        }
-    } else {
-        // RTC not available
-        if (strncmp(dataSource, "rtc", 3) == 0) {
-            return String("No RTC");
+
+        const DateTime& now = frame.now;
+        switch (source) {
+            case DATA_RTC_TIME:
+                // Format: HH:MM:SS
+                snprintf(out, size, "%02d:%02d:%02d", now.hour(), now.minute(), now.second());
+                break;
+            case DATA_RTC_TIME12:
+                {
+                    // Format: HH:MM:SS AM/PM
+                    int hour12 = now.hour() % 12;
+                    if (hour12 == 0) hour12 = 12;
+                    snprintf(out, size, "%02d:%02d:%02d %s", hour12, now.minute(), now.second(),
+                             now.hour() >= 12 ? "PM" : "AM");
+                }
+                break;
+            case DATA_RTC_TIME_SHORT:
+                // Format: HH:MM
+                snprintf(out, size, "%02d:%02d", now.hour(), now.minute());
+                break;
+            case DATA_RTC_DATE:
+                // Format: YYYY-MM-DD
+                snprintf(out, size, "%04d-%02d-%02d", now.year(), now.month(), now.day());
+                break;
+            case DATA_RTC_DATE_SHORT:
+                // Format: MM/DD/YYYY
+                snprintf(out, size, "%02d/%02d/%04d", now.month(), now.day(), now.year());
+                break;
+            default:  // DATA_RTC_DATETIME
+                // Format: YYYY-MM-DD HH:MM:SS
+                snprintf(out, size, "%04d-%02d-%02d %02d:%02d:%02d",
+                         now.year(), now.month(), now.day(),
+                         now.hour(), now.minute(), now.second());
+                break;
         }
+        return;
     }
 
     // Numeric values as strings
-    float value = getDataValue(dataSource);
-    return String(value, 2);
+    snprintf(out, size, "%.2f", getDataValue(frame, source));
 }
 
 // ========== DRAWING FUNCTIONS ==========
 
-// Draw a single screen element
-void drawElement(const ScreenElement& elem) {
-    switch(elem.type) {
-        case ELEM_RECT:
-            if (elem.filled) {
-                gfx.fillRect(elem.x, elem.y, elem.w, elem.h, elem.color);
-            } else {
-                gfx.drawRect(elem.x, elem.y, elem.w, elem.h, elem.color);
-            }
-            break;
+// Pixels and draw calls sent to the panel by the frame being drawn
+static uint32_t framePixels = 0;
+static uint32_t frameDrawCalls = 0;
 
-        case ELEM_LINE:
-            if (elem.w > elem.h) {
-                // Horizontal line
-                gfx.drawFastHLine(elem.x, elem.y, elem.w, elem.color);
-            } else {
-                // Vertical line
-                gfx.drawFastVLine(elem.x, elem.y, elem.h, elem.color);
-            }
-            break;
+// Text shown by a text/value element (label prefix included).
+// Returns false for element types that are not text.
+static bool formatElementText(const ScreenLayout& layout, const ScreenElement& elem,
+                              const FrameContext& frame, char* out, size_t size) {
+    const char* text = layoutString(layout, elem.label);
+    const char* label = elem.showLabel ? text : "";
 
+    switch(elem.type) {
         case ELEM_TEXT_STATIC:
-            {
-                gfx.setTextColor(elem.color);
-                gfx.setTextSize(elem.textSize);
-
-                // Use old rendering if no w/h specified (backward compatibility)
-                if (elem.w == 0 || elem.h == 0) {
-                    gfx.setCursor(elem.x, elem.y);
-                    gfx.print(elem.label);
-                } else {
-                    // Use LovyanGFX smooth font rendering
-                    gfx.setFont(&fonts::Font2);
-                    float scale = elem.textSize * 1.0f;
-                    gfx.setTextSize(scale, scale);
-
-                    switch(elem.align) {
-                        case ALIGN_CENTER:
-                            gfx.setTextDatum(textdatum_t::middle_center);
-                            gfx.drawString(elem.label, elem.x + elem.w / 2, elem.y + elem.h / 2);
-                            break;
-                        case ALIGN_RIGHT:
-                            gfx.setTextDatum(textdatum_t::middle_right);
-                            gfx.drawString(elem.label, elem.x + elem.w, elem.y + elem.h / 2);
-                            break;
-                        default:  // ALIGN_LEFT
-                            gfx.setTextDatum(textdatum_t::middle_left);
-                            gfx.drawString(elem.label, elem.x, elem.y + elem.h / 2);
-                            break;
-                    }
-                }
-            }
-            break;
+            strlcpy(out, text, size);
+            return true;
 
         case ELEM_TEXT_DYNAMIC:
+        case ELEM_STATUS_VALUE:
             {
-                gfx.setTextColor(elem.color);
-                gfx.setTextSize(elem.textSize);
-
-                String value = getDataString(elem.dataSource);
-
-                // Use old rendering if no w/h specified (backward compatibility)
-                if (elem.w == 0 || elem.h == 0) {
-                    gfx.setCursor(elem.x, elem.y);
-                    if (elem.showLabel && strlen(elem.label) > 0) {
-                        gfx.print(elem.label);
-                    }
-                    gfx.print(value);
-                } else {
-                    // Use LovyanGFX smooth font rendering
-                    gfx.setFont(&fonts::Font2);
-                    float scale = elem.textSize * 1.0f;
-                    gfx.setTextSize(scale, scale);
-
-                    String displayText = "";
-                    if (elem.showLabel && strlen(elem.label) > 0) {
-                        displayText = String(elem.label) + value;
-                    } else {
-                        displayText = value;
-                    }
-
-                    switch(elem.align) {
-                        case ALIGN_CENTER:
-                            gfx.setTextDatum(textdatum_t::middle_center);
-                            gfx.drawString(displayText, elem.x + elem.w / 2, elem.y + elem.h / 2);
-                            break;
-                        case ALIGN_RIGHT:
-                            gfx.setTextDatum(textdatum_t::middle_right);
-                            gfx.drawString(displayText, elem.x + elem.w, elem.y + elem.h / 2);
-                            break;
-                        default:  // ALIGN_LEFT
-                            gfx.setTextDatum(textdatum_t::middle_left);
-                            gfx.drawString(displayText, elem.x, elem.y + elem.h / 2);
-                            break;
-                    }
+                size_t labelLen = strlcpy(out, label, size);
+                if (labelLen < size) {
+                    getDataString(frame, elem.source, out + labelLen, size - labelLen);
                 }
             }
-            break;
+            return true;
 
         case ELEM_TEMP_VALUE:
             {
-                gfx.setTextColor(elem.color);
-                gfx.setTextSize(elem.textSize);
-
-                float temp = getDataValue(elem.dataSource);
+                float temp = getDataValue(frame, elem.source);
                 if (cfg.use_fahrenheit) {
                     temp = temp * 9.0 / 5.0 + 32.0;
                 }
-
-                // Use old rendering if no w/h specified (backward compatibility)
-                if (elem.w == 0 || elem.h == 0) {
-                    gfx.setCursor(elem.x, elem.y);
-                    if (elem.showLabel && strlen(elem.label) > 0) {
-                        gfx.print(elem.label);
-                    }
-                    gfx.printf("%.*f%c", elem.decimals, temp,
-                              cfg.use_fahrenheit ? 'F' : 'C');
-                } else {
-                    // Use LovyanGFX smooth font rendering
-                    gfx.setFont(&fonts::Font2);
-                    float scale = elem.textSize * 1.0f;
-                    gfx.setTextSize(scale, scale);
-
-                    char tempStr[32];
-                    snprintf(tempStr, sizeof(tempStr), "%.*f%c", elem.decimals, temp,
-                            cfg.use_fahrenheit ? 'F' : 'C');
-
-                    String displayText = "";
-                    if (elem.showLabel && strlen(elem.label) > 0) {
-                        displayText = String(elem.label) + String(tempStr);
-                    } else {
-                        displayText = String(tempStr);
-                    }
-
-                    switch(elem.align) {
-                        case ALIGN_CENTER:
-                            gfx.setTextDatum(textdatum_t::middle_center);
-                            gfx.drawString(displayText, elem.x + elem.w / 2, elem.y + elem.h / 2);
-                            break;
-                        case ALIGN_RIGHT:
-                            gfx.setTextDatum(textdatum_t::middle_right);
-                            gfx.drawString(displayText, elem.x + elem.w, elem.y + elem.h / 2);
-                            break;
-                        default:  // ALIGN_LEFT
-                            gfx.setTextDatum(textdatum_t::middle_left);
-                            gfx.drawString(displayText, elem.x, elem.y + elem.h / 2);
-                            break;
-                    }
-                }
+                snprintf(out, size, "%s%.*f%c", label, elem.decimals, temp,
+                         cfg.use_fahrenheit ? 'F' : 'C');
             }
-            break;
+            return true;
 
         case ELEM_COORD_VALUE:
             {
-                gfx.setTextColor(elem.color);
-                gfx.setTextSize(elem.textSize);
-
-                float value = getDataValue(elem.dataSource);
+                float value = getDataValue(frame, elem.source);
                 if (cfg.use_inches) {
                     value = value / 25.4;
                 }
+                snprintf(out, size, "%s%.*f", label, elem.decimals, value);
+            }
+            return true;
 
-                // Use old rendering if no w/h specified (backward compatibility)
-                if (elem.w == 0 || elem.h == 0) {
-                    gfx.setCursor(elem.x, elem.y);
-                    if (elem.showLabel && strlen(elem.label) > 0) {
-                        gfx.print(elem.label);
-                    }
-                    gfx.printf("%.*f", elem.decimals, value);
-                } else {
-                    // Use LovyanGFX smooth font rendering
-                    gfx.setFont(&fonts::Font2);
-                    float scale = elem.textSize * 1.0f;
-                    gfx.setTextSize(scale, scale);
-
-                    char coordStr[32];
-                    snprintf(coordStr, sizeof(coordStr), "%.*f", elem.decimals, value);
-
-                    String displayText = "";
-                    if (elem.showLabel && strlen(elem.label) > 0) {
-                        displayText = String(elem.label) + String(coordStr);
-                    } else {
-                        displayText = String(coordStr);
-                    }
-
-                    switch(elem.align) {
-                        case ALIGN_CENTER:
-                            gfx.setTextDatum(textdatum_t::middle_center);
-                            gfx.drawString(displayText, elem.x + elem.w / 2, elem.y + elem.h / 2);
-                            break;
-                        case ALIGN_RIGHT:
-                            gfx.setTextDatum(textdatum_t::middle_right);
-                            gfx.drawString(displayText, elem.x + elem.w, elem.y + elem.h / 2);
-                            break;
-                        default:  // ALIGN_LEFT
-                            gfx.setTextDatum(textdatum_t::middle_left);
-                            gfx.drawString(displayText, elem.x, elem.y + elem.h / 2);
-                            break;
-                    }
-                }
+        default:
+            return false;
+    }
+}
+
+static uint16_t elementTextColor(const ScreenElement& elem, const FrameContext& frame) {
+    // Color-code machine state
+    if (elem.type == ELEM_STATUS_VALUE && elem.source == DATA_MACHINE_STATE) {
+        if (frame.machineState == MACHINE_RUN) return COLOR_GOOD;
+        if (frame.machineState == MACHINE_ALARM) return COLOR_WARN;
+    }
+    return elem.color;
+}
+
+// Count what a draw call sent to the panel. Off-screen targets
+// (screen_snapshot.h) are not the panel and are not counted.
+static void countDrawn(LovyanGFX& dst, uint32_t pixels) {
+    if (&dst != &gfx) return;
+    framePixels += pixels;
+    frameDrawCalls++;
+}
+
+// Select the element's font and work out the box its text will cover
+static ElementBox layoutElementText(const ScreenElement& elem, const char* text, LovyanGFX& dst) {
+    ElementBox box;
+
+    // Use old rendering if no w/h specified (backward compatibility)
+    if (elem.w == 0 || elem.h == 0) {
+        dst.setFont(&fonts::Font0);
+        dst.setTextSize(elem.textSize);
+        box.x = elem.x;
+        box.y = elem.y;
+    } else {
+        // LovyanGFX smooth font, aligned and vertically centred in the element
+        dst.setFont(&fonts::Font2);
+        float scale = elem.textSize * 1.0f;
+        dst.setTextSize(scale, scale);
+        box.y = elem.y + elem.h / 2 - dst.fontHeight() / 2;
+        box.x = elem.x;
+    }
+    box.w = dst.textWidth(text);
+    box.h = dst.fontHeight();
+
+    if (elem.w != 0 && elem.h != 0) {
+        switch(elem.align) {
+            case ALIGN_CENTER:
+                box.x = elem.x + elem.w / 2 - box.w / 2;
+                break;
+            case ALIGN_RIGHT:
+                box.x = elem.x + elem.w - box.w;
+                break;
+            default:  // ALIGN_LEFT
+                break;
+        }
+    }
+    return box;
+}
+
+// Draw text laid out by layoutElementText(). Opaque text paints its own
+// background, so a changed value needs no separate clear.
+static void drawElementText(const ScreenElement& elem, const char* text, uint16_t color,
+                            const ElementBox& box, bool opaque, LovyanGFX& dst, int16_t dy) {
+    if (opaque) {
+        dst.setTextColor(color, elem.bgColor);
+    } else {
+        dst.setTextColor(color);
+    }
+
+    if (elem.w == 0 || elem.h == 0) {
+        dst.setCursor(box.x, box.y + dy);
+        dst.print(text);
+    } else {
+        dst.setTextDatum(textdatum_t::top_left);
+        dst.drawString(text, box.x, box.y + dy);
+    }
+    countDrawn(dst, (uint32_t)box.w * box.h);
+}
+
+static void drawElementGraph(const ScreenElement& elem, const FrameContext& frame,
+                             LovyanGFX& dst, int16_t dy) {
+    if (&dst != &gfx) {
+        // Off-panel - from the frame's history copy, not the panel's column cache
+        if (frame.history != nullptr) {
+            drawTempGraphCopy(dst, dy, *frame.history, elem.x, elem.y, elem.w, elem.h,
+                              elem.bgColor, elem.color);
+        } else {
+            dst.drawRect(elem.x, elem.y + dy, elem.w, elem.h, elem.color);
+        }
+        return;
+    }
+    // Temperature graph (column-cached, see temp_graph.h)
+    drawTempGraph(elem.x, elem.y, elem.w, elem.h, elem.bgColor, elem.color);
+    countDrawn(dst, (uint32_t)elem.w * elem.h);
+}
+
+// Draw a single screen element
+void drawElement(const ScreenLayout& layout, const ScreenElement& elem, const FrameContext& frame,
+                 LovyanGFX& dst, int16_t dy) {
+    char text[ELEMENT_TEXT_MAX];
+    if (formatElementText(layout, elem, frame, text, sizeof(text))) {
+        ElementBox box = layoutElementText(elem, text, dst);
+        drawElementText(elem, text, elementTextColor(elem, frame), box, false, dst, dy);
+        return;
+    }
+
+    int16_t y = elem.y + dy;
+    switch(elem.type) {
+        case ELEM_RECT:
+            if (elem.filled) {
+                dst.fillRect(elem.x, y, elem.w, elem.h, elem.color);
+                countDrawn(dst, (uint32_t)elem.w * elem.h);
+            } else {
+                dst.drawRect(elem.x, y, elem.w, elem.h, elem.color);
+                countDrawn(dst, 2 * (uint32_t)(elem.w + elem.h));
             }
             break;
 
-        case ELEM_STATUS_VALUE:
-            {
-                gfx.setTextSize(elem.textSize);
-
-                // Color-code machine state
-                if (strcmp(elem.dataSource, "machineState") == 0) {
-                    if (machineState == "RUN") {
-                        gfx.setTextColor(COLOR_GOOD);
-                    } else if (machineState == "ALARM") {
-                        gfx.setTextColor(COLOR_WARN);
-                    } else {
-                        gfx.setTextColor(elem.color);
-                    }
-                } else {
-                    gfx.setTextColor(elem.color);
-                }
-
-                String value = getDataString(elem.dataSource);
-
-                // Use old rendering if no w/h specified (backward compatibility)
-                if (elem.w == 0 || elem.h == 0) {
-                    gfx.setCursor(elem.x, elem.y);
-                    if (elem.showLabel && strlen(elem.label) > 0) {
-                        gfx.print(elem.label);
-                    }
-                    gfx.print(value);
-                } else {
-                    // Use LovyanGFX smooth font rendering
-                    gfx.setFont(&fonts::Font2);
-                    float scale = elem.textSize * 1.0f;
-                    gfx.setTextSize(scale, scale);
-
-                    String displayText = "";
-                    if (elem.showLabel && strlen(elem.label) > 0) {
-                        displayText = String(elem.label) + value;
-                    } else {
-                        displayText = value;
-                    }
-
-                    switch(elem.align) {
-                        case ALIGN_CENTER:
-                            gfx.setTextDatum(textdatum_t::middle_center);
-                            gfx.drawString(displayText, elem.x + elem.w / 2, elem.y + elem.h / 2);
-                            break;
-                        case ALIGN_RIGHT:
-                            gfx.setTextDatum(textdatum_t::middle_right);
-                            gfx.drawString(displayText, elem.x + elem.w, elem.y + elem.h / 2);
-                            break;
-                        default:  // ALIGN_LEFT
-                            gfx.setTextDatum(textdatum_t::middle_left);
-                            gfx.drawString(displayText, elem.x, elem.y + elem.h / 2);
-                            break;
-                    }
-                }
+        case ELEM_LINE:
+            if (elem.w > elem.h) {
+                // Horizontal line
+                dst.drawFastHLine(elem.x, y, elem.w, elem.color);
+                countDrawn(dst, elem.w);
+            } else {
+                // Vertical line
+                dst.drawFastVLine(elem.x, y, elem.h, elem.color);
+                countDrawn(dst, elem.h);
             }
             break;
 
         case ELEM_PROGRESS_BAR:
             {
                 // Draw outline
-                gfx.drawRect(elem.x, elem.y, elem.w, elem.h, elem.color);
+                dst.drawRect(elem.x, y, elem.w, elem.h, elem.color);
+                countDrawn(dst, 2 * (uint32_t)(elem.w + elem.h));
 
                 // Calculate progress (placeholder - would need job tracking)
                 int progress = 0;  // 0-100%
@@ -539,58 +770,15 @@ void drawElement(const ScreenElement& elem) {
 
                 // Draw filled portion
                 if (fillWidth > 0) {
-                    gfx.fillRect(elem.x + 1, elem.y + 1,
+                    dst.fillRect(elem.x + 1, y + 1,
                                fillWidth, elem.h - 2, elem.color);
+                    countDrawn(dst, (uint32_t)fillWidth * (elem.h - 2));
                 }
             }
             break;
 
         case ELEM_GRAPH:
-            {
-                // Draw temperature graph
-                gfx.fillRect(elem.x, elem.y, elem.w, elem.h, elem.bgColor);
-                gfx.drawRect(elem.x, elem.y, elem.w, elem.h, elem.color);
-
-                if (tempHistory != nullptr && historySize > 0) {
-                    float minTemp = 10.0;
-                    float maxTemp = 60.0;
-
-                    // Draw temperature line
-                    for (int i = 1; i < historySize; i++) {
-                        int idx1 = (historyIndex + i - 1) % historySize;
-                        int idx2 = (historyIndex + i) % historySize;
-
-                        float temp1 = tempHistory[idx1];
-                        float temp2 = tempHistory[idx2];
-
-                        int x1 = elem.x + ((i - 1) * elem.w / historySize);
-                        int y1 = elem.y + elem.h - ((temp1 - minTemp) / (maxTemp - minTemp) * elem.h);
-                        int x2 = elem.x + (i * elem.w / historySize);
-                        int y2 = elem.y + elem.h - ((temp2 - minTemp) / (maxTemp - minTemp) * elem.h);
-
-                        y1 = constrain(y1, elem.y, elem.y + elem.h);
-                        y2 = constrain(y2, elem.y, elem.y + elem.h);
-
-                        // Color based on temperature (use element color or threshold-based)
-                        uint16_t color;
-                        if (temp2 > cfg.temp_threshold_high) color = COLOR_WARN;
-                        else if (temp2 > cfg.temp_threshold_low) color = COLOR_ORANGE;
-                        else color = COLOR_GOOD;
-
-                        gfx.drawLine(x1, y1, x2, y2, color);
-                    }
-
-                    // Scale markers
-                    gfx.setTextSize(1);
-                    gfx.setTextColor(elem.color);
-                    gfx.setCursor(elem.x + 3, elem.y + 2);
-                    gfx.print("60");
-                    gfx.setCursor(elem.x + 3, elem.y + elem.h / 2 - 5);
-                    gfx.print("35");
-                    gfx.setCursor(elem.x + 3, elem.y + elem.h - 10);
-                    gfx.print("10");
-                }
-            }
+            drawElementGraph(elem, frame, dst, dy);
             break;
 
         default:
@@ -598,6 +786,86 @@ void drawElement(const ScreenElement& elem) {
     }
 }
 
+// ========== RETAINED RENDERING ==========
+// What is currently on the glass for each element of the drawn layout, so
+// updateScreenFromLayout() repaints only elements whose output changed.
+
+struct ElementCache {
+    char text[ELEMENT_TEXT_MAX];    // Last text drawn (text/value elements)
+    uint16_t color;                 // Its color
+    ElementBox box;                 // Area it covered
+    uint32_t key;                   // Graph: history position drawn
+};
+
+static ElementCache elementCache[MAX_SCREEN_ELEMENTS];
+
+// Values for the frame being drawn - captured once per draw/update
+static FrameContext frame;
+
+RenderStats renderStats = {0, 0, 0, 0, 0, 0, 0, 0};
+
+static uint32_t graphKey() {
+    return ((uint32_t)history.historySize << 16) | history.historyIndex;
+}
+
+// Remember what drawElement() just put on screen
+static void primeElementCache(const ScreenLayout& layout, const ScreenElement& elem,
+                              ElementCache& cache) {
+    cache.key = graphKey();
+    if (formatElementText(layout, elem, frame, cache.text, sizeof(cache.text))) {
+        cache.color = elementTextColor(elem, frame);
+        cache.box = layoutElementText(elem, cache.text, gfx);
+    } else {
+        cache.text[0] = '\0';
+        cache.box.w = 0;
+    }
+}
+
+// Repaint one element if its output changed; true if it was redrawn
+static bool refreshElement(const ScreenLayout& layout, const ScreenElement& elem,
+                           ElementCache& cache) {
+    switch(elem.type) {
+        case ELEM_TEXT_DYNAMIC:
+        case ELEM_TEMP_VALUE:
+        case ELEM_COORD_VALUE:
+        case ELEM_STATUS_VALUE:
+            break;
+
+        case ELEM_GRAPH:
+            if (cache.key == graphKey()) return false;
+            cache.key = graphKey();
+            countDrawn(gfx, updateTempGraph(elem.x, elem.y, elem.w, elem.h, elem.bgColor, elem.color));
+            return true;
+
+        default:
+            return false;  // Static - drawn once by drawScreenFromLayout()
+    }
+
+    char text[ELEMENT_TEXT_MAX];
+    formatElementText(layout, elem, frame, text, sizeof(text));
+    uint16_t color = elementTextColor(elem, frame);
+    if (color == cache.color && strcmp(text, cache.text) == 0) {
+        return false;
+    }
+
+    // Clear the old text only where the new (opaque) text won't cover it
+    ElementBox box = layoutElementText(elem, text, gfx);
+    const ElementBox& old = cache.box;
+    bool covered = old.x >= box.x && old.y >= box.y &&
+                   old.x + old.w <= box.x + box.w && old.y + old.h <= box.y + box.h;
+    if (!covered && old.w > 0) {
+        gfx.fillRect(old.x, old.y, old.w, old.h, elem.bgColor);
+        countDrawn(gfx, (uint32_t)old.w * old.h);
+    }
+
+    drawElementText(elem, text, color, box, true, gfx, 0);
+
+    strlcpy(cache.text, text, sizeof(cache.text));
+    cache.color = color;
+    cache.box = box;
+    return true;
+}
+
 // Draw entire screen from layout definition
 void drawScreenFromLayout(const ScreenLayout& layout) {
     if (!layout.isValid) {
@@ -605,11 +873,62 @@ void drawScreenFromLayout(const ScreenLayout& layout) {
         return;
     }
 
+    framePixels = 0;
+    frameDrawCalls = 0;
+    captureFrameContext(frame, layout.frameNeeds);
+
     // Clear screen with background color
     gfx.fillScreen(layout.backgroundColor);
+    countDrawn(gfx, (uint32_t)SCREEN_WIDTH * SCREEN_HEIGHT);
 
     // Draw all elements
+    perfResetElements(layout.elementCount);
     for (uint8_t i = 0; i < layout.elementCount; i++) {
-        drawElement(layout.elements[i]);
+        unsigned long start = micros();
+        drawElement(layout, layout.elements[i], frame);
+        perfRecordElement(i, micros() - start);
+        primeElementCache(layout, layout.elements[i], elementCache[i]);
     }
+    cachedLayout = &layout;
+
+    // Baseline for the savings of later incremental frames
+    renderStats.pixelsFullRedraw = framePixels;
+    renderStats.pixelsLastFrame = framePixels;
+    renderStats.drawCallsFullRedraw = frameDrawCalls;
+    renderStats.drawCallsLastFrame = frameDrawCalls;
+    renderStats.elementsRedrawn = layout.elementCount;
+    renderStats.pixelsSentTotal += framePixels;
+}
+
+void updateScreenFromLayout(const ScreenLayout& layout) {
+    if (!layout.isValid) return;
+    if (cachedLayout != &layout) {
+        drawScreenFromLayout(layout);  // Nothing retained for this layout yet
+        return;
+    }
+
+    framePixels = 0;
+    frameDrawCalls = 0;
+    captureFrameContext(frame, layout.frameNeeds);
+    uint8_t redrawn = 0;
+    for (uint8_t i = 0; i < layout.elementCount; i++) {
+        unsigned long start = micros();
+        if (refreshElement(layout, layout.elements[i], elementCache[i])) {
+            perfRecordElement(i, micros() - start);
+            redrawn++;
+        }
+    }
+
+    renderStats.frames++;
+    renderStats.elementsRedrawn = redrawn;
+    renderStats.pixelsLastFrame = framePixels;
+    renderStats.drawCallsLastFrame = frameDrawCalls;
+    renderStats.pixelsSentTotal += framePixels;
+    if (renderStats.pixelsFullRedraw > framePixels) {
+        renderStats.pixelsSavedTotal += renderStats.pixelsFullRedraw - framePixels;
+    }
+}
+
+void invalidateScreenLayout() {
+    cachedLayout = nullptr;
 }
@@ -3,22 +3,113 @@
 
 #include <Arduino.h>
 #include "config/config.h"
+#include "state/global_state.h"
+#include "display.h"
+#include <RTClib.h>
 
 // JSON parsing functions
 uint16_t parseColor(const char* hexColor);
 ElementType parseElementType(const char* typeStr);
 TextAlign parseAlignment(const char* alignStr);
 
-// Screen layout functions
+// Screen layout functions. Loading replaces whatever 'layout' held; the
+// compiled form is cached in LittleFS (see layout_cache.h). Without a file
+// at 'filename' the built-in copy is used, if any (builtin_layouts.h).
 bool loadScreenConfig(const char* filename, ScreenLayout& layout);
+void freeScreenLayout(ScreenLayout& layout);
 void initDefaultLayouts();
 
+// ========== Frame Context ==========
+// Every displayable value, captured once at the start of a render so all
+// elements of a frame agree (no value changing halfway through a frame)
+// and the RTC is read over I2C once per frame rather than per element.
+// JSON layouts and the built-in screens' full redraws both draw from it.
+
+struct TempHistoryCopy;
+
+struct FrameContext {
+    // FluidNC (from the core-1 view)
+    bool connected;
+    MachineState machineState;
+    int8_t machineSubstate;
+    char stateText[16];
+    float pos[4];
+    float wpos[4];
+    int feedRate;
+    int spindleRPM;
+
+    // Sensors
+    float temperatures[4];
+    float peakTemps[4];
+    float psuVoltage;
+    uint8_t fanSpeed;
+    uint16_t fanRPM;
+
+    // Sensor at each display position (X, YL, YR, Z): friendly name, or
+    // the position's default - only filled when the screen needs it
+    char sensorNames[4][13];
+
+    // Network - only filled when the layout needs it
+    char ipAddress[16];
+    char ssid[33];
+
+    // RTC - only read when the layout needs it
+    bool rtcValid;
+    DateTime now;
+
+    // Snapshots only: graphs are drawn from this copy (nullptr on the panel)
+    TempHistoryCopy* history;
+};
+
+// needs: FRAME_NEEDS_* flags (ScreenLayout::frameNeeds). Display core only.
+void captureFrameContext(FrameContext& frame, uint8_t needs);
+
+// The same on the network task, for snapshots: FluidNC from the task's own
+// state, sensors from sensorsView, sensor names under the bus lock. The RTC
+// shares I2C with the display core, so clocks show SNAPSHOT_CLOCK instead.
+void captureSnapshotFrame(FrameContext& frame, uint8_t needs, TempHistoryCopy* history);
+
 // Drawing functions
-void drawScreenFromLayout(const ScreenLayout& layout);
-void drawElement(const ScreenElement& elem);
+void drawScreenFromLayout(const ScreenLayout& layout);   // Full redraw
+// Any LovyanGFX target: the panel, or a sprite holding rows -dy.. of the
+// screen (screen_snapshot.h). Only draws to the panel are counted.
+void drawElement(const ScreenLayout& layout, const ScreenElement& elem, const FrameContext& frame,
+                 LovyanGFX& dst = gfx, int16_t dy = 0);
+
+// ========== Retained Rendering ==========
+// After drawScreenFromLayout(), updateScreenFromLayout() re-formats the
+// value elements and repaints only those whose text or color changed (and
+// graphs whose history moved), clearing just the old text box. Value
+// elements are assumed not to overlap other elements; their box is cleared
+// with the element's bgColor.
+
+#define ELEMENT_TEXT_MAX 48     // Label + formatted value
+
+struct ElementBox {
+    int16_t x, y, w, h;
+};
+
+// Pixels pushed over SPI - compare with a full redraw to see the saving
+struct RenderStats {
+    uint32_t frames;                // Incremental updates
+    uint32_t elementsRedrawn;       // In the last frame
+    uint32_t pixelsLastFrame;
+    uint32_t pixelsFullRedraw;      // What drawScreenFromLayout() sent
+    uint32_t drawCallsLastFrame;    // gfx calls issued
+    uint32_t drawCallsFullRedraw;
+    uint64_t pixelsSentTotal;
+    uint64_t pixelsSavedTotal;      // vs. a full redraw every frame
+};
+extern RenderStats renderStats;
+
+void updateScreenFromLayout(const ScreenLayout& layout);
+
+// Force the next update to redraw fully (layout reloaded or screen overdrawn)
+void invalidateScreenLayout();
 
-// Data access functions
-float getDataValue(const char* dataSource);
-String getDataString(const char* dataSource);
+// Data access functions (sources are bound at load time)
+DataSourceId parseDataSource(const char* name);
+float getDataValue(const FrameContext& frame, DataSourceId source);
+void getDataString(const FrameContext& frame, DataSourceId source, char* out, size_t size);
 
 #endif // SCREEN_RENDERER_H
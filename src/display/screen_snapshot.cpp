@@ -0,0 +1,143 @@
+#include "screen_snapshot.h"
+#include "display.h"
+#include "ui_modes.h"
+#include "screen_renderer.h"
+#include "chrome_cache.h"
+#include "temp_graph.h"
+
+SnapshotStats snapshotStats = {0, 0, 0};
+
+// What to draw into each band
+struct SnapshotSource {
+    ChromeDrawFn chrome;        // Built-in mode: chrome, then values, or
+    ChromeDrawFn values;
+    const ScreenLayout* layout; // JSON layout
+    const FrameContext* frame;
+    uint16_t background;
+};
+
+static void put16(uint8_t* p, uint16_t value) {
+    p[0] = value & 0xFF;
+    p[1] = value >> 8;
+}
+
+static void put32(uint8_t* p, uint32_t value) {
+    put16(p, value & 0xFFFF);
+    put16(p + 2, value >> 16);
+}
+
+// BITMAPFILEHEADER + BITMAPINFOHEADER (BI_BITFIELDS) + RGB565 masks.
+// Negative height: rows are stored top-down, the order bands are rendered in.
+static void writeBmpHeader(SnapshotWriteFn write) {
+    uint8_t header[SNAPSHOT_HEADER_BYTES];
+    memset(header, 0, sizeof(header));
+
+    header[0] = 'B';
+    header[1] = 'M';
+    put32(header + 2, SNAPSHOT_BYTES);
+    put32(header + 10, SNAPSHOT_HEADER_BYTES);     // Pixel data offset
+
+    put32(header + 14, 40);                        // Info header size
+    put32(header + 18, SCREEN_WIDTH);
+    put32(header + 22, (uint32_t)-SCREEN_HEIGHT);
+    put16(header + 26, 1);                         // Planes
+    put16(header + 28, 16);                        // Bits per pixel
+    put32(header + 30, 3);                         // BI_BITFIELDS
+    put32(header + 34, (uint32_t)SCREEN_WIDTH * SCREEN_HEIGHT * 2);
+    put32(header + 38, 2835);                      // 72 dpi
+    put32(header + 42, 2835);
+
+    put32(header + 54, 0xF800);                    // Red mask
+    put32(header + 58, 0x07E0);                    // Green
+    put32(header + 62, 0x001F);                    // Blue
+
+    write(header, sizeof(header));
+}
+
+static bool streamSnapshot(const SnapshotSource& source, SnapshotWriteFn write) {
+    LGFX_Sprite band;
+    band.setColorDepth(16);
+    if (band.createSprite(SCREEN_WIDTH, SNAPSHOT_BAND_ROWS) == nullptr) {
+        Serial.println("[Display] Snapshot sprite allocation failed");
+        snapshotStats.failures++;
+        return false;
+    }
+
+    writeBmpHeader(write);
+
+    uint32_t renderUs = 0;
+    uint16_t* pixels = (uint16_t*)band.getBuffer();
+    const uint32_t pixelCount = (uint32_t)SCREEN_WIDTH * SNAPSHOT_BAND_ROWS;
+
+    for (int16_t bandY = 0; bandY < SCREEN_HEIGHT; bandY += SNAPSHOT_BAND_ROWS) {
+        unsigned long start = micros();
+        band.fillScreen(source.background);
+        if (source.chrome) {
+            source.chrome(band, -bandY, *source.frame);
+            source.values(band, -bandY, *source.frame);
+        } else {
+            for (uint8_t i = 0; i < source.layout->elementCount; i++) {
+                drawElement(*source.layout, source.layout->elements[i], *source.frame, band, -bandY);
+            }
+        }
+        renderUs += micros() - start;
+
+        // Sprite memory is big-endian RGB565, BMP little-endian
+        for (uint32_t i = 0; i < pixelCount; i++) {
+            pixels[i] = (pixels[i] >> 8) | (pixels[i] << 8);
+        }
+        write((const uint8_t*)pixels, pixelCount * sizeof(uint16_t));
+        yield();
+    }
+
+    band.deleteSprite();
+    snapshotStats.count++;
+    snapshotStats.lastRenderUs = renderUs;
+    return true;
+}
+
+// Capture the frame (and the history graphs are drawn from), then stream
+static bool streamWithFrame(SnapshotSource& source, uint8_t needs, SnapshotWriteFn write) {
+    TempHistoryCopy history;
+    copyTempHistory(history);   // On failure graphs are drawn empty
+
+    FrameContext frame;
+    captureSnapshotFrame(frame, needs, &history);
+    source.frame = &frame;
+    bool ok = streamSnapshot(source, write);
+
+    freeTempHistory(history);
+    return ok;
+}
+
+bool snapshotMode(DisplayMode mode, SnapshotWriteFn write) {
+    SnapshotSource source = {nullptr, nullptr, nullptr, nullptr, COLOR_BG};
+    uint8_t needs = CHROME_FRAME_NEEDS;
+    switch (mode) {
+        case MODE_MONITOR:
+            source.chrome = drawMonitorChrome;
+            source.values = drawMonitorValues;
+            needs |= MONITOR_FRAME_NEEDS;
+            break;
+        case MODE_ALIGNMENT:
+            source.chrome = drawAlignmentChrome;
+            source.values = drawAlignmentValues;
+            needs |= ALIGNMENT_FRAME_NEEDS;
+            break;
+        case MODE_GRAPH:
+            source.chrome = drawGraphChrome;
+            source.values = drawGraphValues;
+            needs |= GRAPH_FRAME_NEEDS;
+            break;
+        default:
+            return false;
+    }
+    return streamWithFrame(source, needs, write);
+}
+
+bool snapshotLayout(const ScreenLayout& layout, SnapshotWriteFn write) {
+    if (!layout.isValid) return false;
+
+    SnapshotSource source = {nullptr, nullptr, &layout, nullptr, layout.backgroundColor};
+    return streamWithFrame(source, layout.frameNeeds, write);
+}
@@ -0,0 +1,44 @@
+#ifndef SCREEN_SNAPSHOT_H
+#define SCREEN_SNAPSHOT_H
+
+#include <Arduino.h>
+#include "config/config.h"
+
+// ========== Screen Snapshots ==========
+// Renders a screen into RAM instead of onto the panel and streams it as a
+// 16-bit BMP, so layouts can be checked and renders compared between builds
+// (e.g. diffed against a saved image) without looking at the hardware.
+//
+// The panel cannot be read back (MISO is not wired) and a full frame does
+// not fit in RAM, so the screen is re-rendered SNAPSHOT_BAND_ROWS at a time
+// into a small sprite, like the chrome cache. Built-in modes draw what a
+// full redraw puts on the panel - chrome and values; JSON layouts draw
+// every element. Graphs are plotted from a copy of the history.
+//
+// Snapshots run on the network task, so nothing is read from the display
+// core's state: values come from one captureSnapshotFrame() taken up
+// front. The RTC is not read; clocks show SNAPSHOT_CLOCK, which also keeps
+// two snapshots of the same state byte-identical.
+
+#define SNAPSHOT_BAND_ROWS 10           // Sprite: 480 x 10 px = 9.6 KB while streaming
+#define SNAPSHOT_CLOCK DateTime(2000, 1, 1, 0, 0, 0)
+#define SNAPSHOT_HEADER_BYTES 66        // BMP file + info header + RGB565 masks
+#define SNAPSHOT_BYTES (SNAPSHOT_HEADER_BYTES + (uint32_t)SCREEN_WIDTH * SCREEN_HEIGHT * 2)
+
+// Receives the BMP in order, SNAPSHOT_HEADER_BYTES first, then one band at a time
+typedef void (*SnapshotWriteFn)(const uint8_t* data, size_t length);
+
+// Built-in mode; false for modes not drawn this way (network, storage, DRO)
+bool snapshotMode(DisplayMode mode, SnapshotWriteFn write);
+
+// A loaded JSON layout
+bool snapshotLayout(const ScreenLayout& layout, SnapshotWriteFn write);
+
+struct SnapshotStats {
+    uint32_t count;
+    uint32_t lastRenderUs;      // Drawing only - streaming excluded
+    uint32_t failures;          // Sprite allocation failed (a missing history copy only blanks graphs)
+};
+extern SnapshotStats snapshotStats;
+
+#endif // SCREEN_SNAPSHOT_H
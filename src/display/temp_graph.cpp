@@ -0,0 +1,239 @@
+#include "temp_graph.h"
+#include "display.h"
+#include "region_compositor.h"
+#include "config/config.h"
+#include "state/global_state.h"
+#include "utils/decimator.h"
+#include "utils/utils.h"
+
+// Geometry/state the cached columns were built for
+struct GraphCache {
+    int16_t x, y, w, h;
+    uint16_t bg, frame;
+    const float* buffer;
+    uint16_t size;
+    bool valid;
+};
+
+static Envelope envelopes[TEMP_GRAPH_MAX_COLUMNS];
+static EnvelopeDecimator decimator(envelopes, TEMP_GRAPH_MAX_COLUMNS);
+static GraphCache cache = {0, 0, 0, 0, 0, 0, nullptr, 0, false};
+
+// ========== Sample Mapping ==========
+// Samples are numbered so that sample a lives at tempHistory[a % size]:
+// the prefill is size..2*size-1 and added sample n is 2*size + n (starting
+// at size keeps the first column number from going negative). The newest
+// sample sits in the rightmost column; the oldest may fall just off the left.
+
+static inline int plotWidth(const GraphCache& g = cache) { return g.w - 2; }      // Inside the frame
+static inline int plotHeight(const GraphCache& g = cache) { return g.h - 2; }
+
+static inline uint32_t historyTotal() {
+    return 2 * history.historySize + history.sampleCount;
+}
+
+static void addSamplesUpTo(uint32_t total) {
+    while (decimator.nextSample() < total) {
+        decimator.add(history.tempHistory[decimator.nextSample() % cache.size]);
+    }
+}
+
+static int16_t tempY(const GraphCache& g, float temp) {
+    int top = g.y + 1;
+    int bottom = top + plotHeight(g) - 1;
+    int y = bottom - (int)((temp - TEMP_GRAPH_MIN_TEMP) /
+                           (TEMP_GRAPH_MAX_TEMP - TEMP_GRAPH_MIN_TEMP) * (plotHeight(g) - 1));
+    return constrain(y, top, bottom);
+}
+
+static uint16_t tempColor(float temp) {
+    if (temp > cfg.temp_threshold_high) return COLOR_WARN;
+    if (temp > cfg.temp_threshold_low) return COLOR_ORANGE;
+    return COLOR_GOOD;
+}
+
+// Screen span of a column: its envelope joined to the previous column
+static void columnSpan(const GraphCache& g, const EnvelopeDecimator& d, uint32_t column,
+                       int16_t& top, int16_t& bottom, uint16_t& color) {
+    const Envelope& e = d.at(column);
+    float lo = e.min;
+    float hi = e.max;
+    if (column != d.firstColumn()) {
+        float prev = d.at(column - 1).last;
+        lo = min(lo, prev);
+        hi = max(hi, prev);
+    }
+    top = tempY(g, hi);
+    bottom = tempY(g, lo);
+    color = tempColor(e.max);       // Worst sample in the column
+}
+
+// ========== Drawing ==========
+
+static void drawScaleMarkers(LovyanGFX* target, int originX, int originY, const GraphCache& g = cache) {
+    target->setTextSize(1);
+    target->setTextColor(g.frame);
+    target->setCursor(g.x + 3 - originX, g.y + 2 - originY);
+    target->print("60");
+    target->setCursor(g.x + 3 - originX, g.y + g.h / 2 - 5 - originY);
+    target->print("35");
+    target->setCursor(g.x + 3 - originX, g.y + g.h - 10 - originY);
+    target->print("10");
+}
+
+// Draw cached columns onto `target`, whose (0,0) is at (originX, originY)
+static void drawColumns(LovyanGFX* target, int originX, int originY,
+                        const GraphCache& g = cache, const EnvelopeDecimator& d = decimator) {
+    uint32_t first = d.firstColumn();
+    for (int i = 0; i < plotWidth(g); i++) {
+        int16_t top, bottom;
+        uint16_t color;
+        columnSpan(g, d, first + i, top, bottom, color);
+        target->drawFastVLine(g.x + 1 + i - originX, top - originY, bottom - top + 1, color);
+    }
+}
+
+// Render the whole plot area from the cache, in compositor-sized bands
+static uint32_t drawPlot() {
+    int plotX = cache.x + 1;
+    int plotY = cache.y + 1;
+    int bandRows = max(1, COMPOSITOR_MAX_PIXELS / plotWidth());
+    uint32_t pixels = (uint32_t)plotWidth() * plotHeight();
+
+    compositorBeginFrame();
+    for (int row = 0; row < plotHeight(); row += bandRows) {
+        int rows = min(bandRows, plotHeight() - row);
+        LGFX_Sprite* band = beginRegion(plotX, plotY + row, plotWidth(), rows, cache.bg);
+        if (band == nullptr) {
+            // No compositor - clear and draw on the panel
+            compositorEndFrame();
+            gfx.fillRect(plotX, plotY, plotWidth(), plotHeight(), cache.bg);
+            drawColumns(&gfx, 0, 0);
+            drawScaleMarkers(&gfx, 0, 0);
+            return pixels;
+        }
+        drawColumns(band, plotX, plotY + row);
+        drawScaleMarkers(band, plotX, plotY + row);
+        endRegion();
+    }
+    compositorEndFrame();
+    return pixels;
+}
+
+// Redraw one column in place (plot did not scroll)
+static uint32_t drawColumn(uint32_t column) {
+    int sx = cache.x + 1 + (column - decimator.firstColumn());
+    int16_t top, bottom;
+    uint16_t color;
+    columnSpan(cache, decimator, column, top, bottom, color);
+
+    gfx.drawFastVLine(sx, cache.y + 1, plotHeight(), cache.bg);
+    gfx.drawFastVLine(sx, top, bottom - top + 1, color);
+    if (sx < cache.x + 16) {
+        drawScaleMarkers(&gfx, 0, 0);   // Column runs under the markers
+    }
+    return plotHeight();
+}
+
+void drawTempGraph(int x, int y, int w, int h, uint16_t bg, uint16_t frame) {
+    cache.valid = false;
+    if (history.tempHistory == nullptr || history.historySize == 0 ||
+        w < 3 || h < 3 || w - 2 > TEMP_GRAPH_MAX_COLUMNS) {
+        gfx.fillRect(x, y, w, h, bg);
+        gfx.drawRect(x, y, w, h, frame);
+        return;
+    }
+
+    cache.x = x;
+    cache.y = y;
+    cache.w = w;
+    cache.h = h;
+    cache.bg = bg;
+    cache.frame = frame;
+    cache.buffer = history.tempHistory;
+    cache.size = history.historySize;
+
+    // Build every column of the current window
+    uint32_t total = historyTotal();
+    decimator.begin(plotWidth(), cache.size, total - cache.size);
+    addSamplesUpTo(total);
+    cache.valid = true;
+
+    gfx.drawRect(x, y, w, h, frame);
+    drawPlot();
+}
+
+uint32_t updateTempGraph(int x, int y, int w, int h, uint16_t bg, uint16_t frame) {
+    uint32_t total = historyTotal();
+
+    if (!cache.valid || cache.x != x || cache.y != y || cache.w != w || cache.h != h ||
+        cache.bg != bg || cache.frame != frame ||
+        cache.buffer != history.tempHistory || cache.size != history.historySize ||
+        total < decimator.nextSample() || total - decimator.nextSample() >= cache.size) {
+        drawTempGraph(x, y, w, h, bg, frame);
+        return (uint32_t)w * h;
+    }
+
+    if (total == decimator.nextSample()) return 0;
+
+    uint32_t lastColumn = decimator.lastColumn();
+    addSamplesUpTo(total);
+
+    // Newest sample moved into a new column - scroll the whole plot
+    if (decimator.lastColumn() != lastColumn) {
+        return drawPlot();
+    }
+
+    // Same window - only the rightmost column widened
+    return drawColumn(lastColumn);
+}
+
+uint32_t tempGraphVersion() {
+    return ((uint32_t)history.historySize << 16) + history.sampleCount;
+}
+
+// ========== History Copies ==========
+
+bool copyTempHistory(TempHistoryCopy& copy) {
+    copy.samples = nullptr;
+    copy.size = 0;
+    copy.total = 0;
+
+    HistoryLock lock;
+    if (history.tempHistory == nullptr || history.historySize == 0) return false;
+    float* samples = (float*)malloc(history.historySize * sizeof(float));
+    if (samples == nullptr) return false;
+    memcpy(samples, history.tempHistory, history.historySize * sizeof(float));
+
+    copy.samples = samples;
+    copy.size = history.historySize;
+    copy.total = historyTotal();
+    return true;
+}
+
+void freeTempHistory(TempHistoryCopy& copy) {
+    free(copy.samples);
+    copy.samples = nullptr;
+    copy.size = 0;
+}
+
+void drawTempGraphCopy(LovyanGFX& dst, int16_t dy, const TempHistoryCopy& copy,
+                       int x, int y, int w, int h, uint16_t bg, uint16_t frame) {
+    dst.fillRect(x, y + dy, w, h, bg);
+    dst.drawRect(x, y + dy, w, h, frame);
+    if (copy.samples == nullptr || w < 3 || h < 3 || w - 2 > TEMP_GRAPH_MAX_COLUMNS) return;
+
+    // Same columns as drawTempGraph() builds from the live history
+    GraphCache g = {(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, bg, frame, copy.samples, copy.size, true};
+    Envelope* columns = (Envelope*)malloc((w - 2) * sizeof(Envelope));
+    if (columns == nullptr) return;
+    EnvelopeDecimator d(columns, w - 2);
+    d.begin(w - 2, copy.size, copy.total - copy.size);
+    while (d.nextSample() < copy.total) {
+        d.add(copy.samples[d.nextSample() % copy.size]);
+    }
+
+    drawColumns(&dst, 0, -dy, g, d);
+    drawScaleMarkers(&dst, 0, -dy, g);
+    free(columns);
+}
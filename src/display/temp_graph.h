@@ -0,0 +1,55 @@
+#ifndef TEMP_GRAPH_H
+#define TEMP_GRAPH_H
+
+#include <Arduino.h>
+#include "config/pins.h"
+#include <LovyanGFX.hpp>
+
+// ========== Temperature History Graph ==========
+// Each pixel column shows the min/max envelope of the history samples that
+// map to it (utils/decimator.h), kept up to date as samples arrive, so a
+// short spike is never lost between pixels. A new sample only extends the
+// rightmost column; the plot scrolls left when it starts a new column. A scroll re-renders
+// the plot from the column cache through the region compositor, so nothing
+// is cleared on the panel and no history sample is re-read.
+//
+// One cache serves whichever graph is on screen. A full redraw happens on
+// drawTempGraph() (mode entry), when the position/size or colors change,
+// and when the history buffer is reallocated.
+
+#define TEMP_GRAPH_MAX_COLUMNS 480
+#define TEMP_GRAPH_MIN_TEMP 10.0f   // Fixed axis, C
+#define TEMP_GRAPH_MAX_TEMP 60.0f
+
+// Full redraw - frame, plot and scale markers
+void drawTempGraph(int x, int y, int w, int h,
+                   uint16_t bg = COLOR_BG, uint16_t frame = COLOR_LINE);
+
+// Draw only what changed since the last draw/update; returns pixels sent
+uint32_t updateTempGraph(int x, int y, int w, int h,
+                         uint16_t bg = COLOR_BG, uint16_t frame = COLOR_LINE);
+
+// Changes whenever updateTempGraph() would have something to draw
+uint32_t tempGraphVersion();
+
+// ========== History Copies ==========
+// Off-panel renders (screen_snapshot.h) run on the network task, so they
+// work from a copy of the history taken under HistoryLock and leave the
+// panel's column cache alone.
+
+struct TempHistoryCopy {
+    float* samples;             // Same ring layout as history.tempHistory
+    uint16_t size;
+    uint32_t total;             // Sample numbering, as used by the column cache
+};
+
+// Copy the current history (malloc'd - free with freeTempHistory)
+bool copyTempHistory(TempHistoryCopy& copy);
+void freeTempHistory(TempHistoryCopy& copy);
+
+// Full graph from a copy onto any target; dy is added to every y coordinate
+void drawTempGraphCopy(LovyanGFX& dst, int16_t dy, const TempHistoryCopy& copy,
+                       int x, int y, int w, int h,
+                       uint16_t bg = COLOR_BG, uint16_t frame = COLOR_LINE);
+
+#endif // TEMP_GRAPH_H
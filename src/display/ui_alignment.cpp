@@ -4,6 +4,11 @@
 #include "display.h"
 #include "config/config.h"
 #include "sensors/sensors.h"
+#include "motion_estimator.h"
+#include "digit_atlas.h"
+#include "render_scheduler.h"
+#include "chrome_cache.h"
+#include "screen_renderer.h"
 
 // External variables from main.cpp
 extern Config cfg;
@@ -15,192 +20,199 @@ inline float convertTemp(float celsius) {
 
 // ========== ALIGNMENT MODE ==========
 
-void drawAlignmentMode() {
-  gfx.fillScreen(COLOR_BG);
-
-  // Header
-  gfx.fillRect(0, 0, SCREEN_WIDTH, CommonLayout::HEADER_HEIGHT, COLOR_HEADER);
-  gfx.setTextColor(COLOR_TEXT);
-  gfx.setTextSize(AlignmentLayout::TITLE_FONT_SIZE);
-  gfx.setCursor(AlignmentLayout::TITLE_X, AlignmentLayout::TITLE_Y);
-  gfx.print("ALIGNMENT MODE");
-
-  gfx.drawFastHLine(0, CommonLayout::HEADER_HEIGHT, SCREEN_WIDTH, COLOR_LINE);
+// Digits on screen per axis - only the character cells that change are
+// pushed from the glyph atlas, which keeps 25 Hz DRO updates flicker-free
+static DigitField droFields[4];
+static bool droHas4Axes = false;
 
-  // Title
-  gfx.setTextSize(AlignmentLayout::SUBTITLE_FONT_SIZE);
-  gfx.setTextColor(COLOR_HEADER);
-  gfx.setCursor(AlignmentLayout::SUBTITLE_X, AlignmentLayout::SUBTITLE_Y);
-  gfx.print("WORK POSITION");
-
-  // Detect if 4-axis machine (if A-axis is non-zero or moving)
-  bool has4Axes = (fluidnc.posA != 0 || fluidnc.wposA != 0);
-
-  if (has4Axes) {
-    // 4-AXIS DISPLAY - Slightly smaller to fit all axes
-    gfx.setTextSize(AlignmentLayout::COORD_4AXIS_FONT_SIZE);
-    gfx.setTextColor(COLOR_VALUE);
+static void scheduleAlignmentFields();
 
-    char coordFormat[20];
-    if (cfg.coord_decimal_places == 3) {
-      strcpy(coordFormat, "X:%9.3f");
+static void initDroFields(DigitField* fields, bool has4Axes) {
+  for (uint8_t axis = 0; axis < 4; axis++) {
+    if (has4Axes) {
+      initDigitField(fields[axis], AlignmentLayout::COORD_4AXIS_VALUE_X,
+                     AlignmentLayout::COORD_4AXIS_START_Y + axis * AlignmentLayout::COORD_4AXIS_SPACING,
+                     AlignmentLayout::COORD_4AXIS_FONT_SIZE, COLOR_BG);
     } else {
-      strcpy(coordFormat, "X:%8.2f");
+      initDigitField(fields[axis], AlignmentLayout::COORD_3AXIS_VALUE_X,
+                     AlignmentLayout::COORD_3AXIS_START_Y + axis * AlignmentLayout::COORD_3AXIS_SPACING,
+                     AlignmentLayout::COORD_3AXIS_FONT_SIZE, COLOR_BG);
     }
+  }
+}
 
-    gfx.setCursor(AlignmentLayout::COORD_4AXIS_START_X, AlignmentLayout::COORD_4AXIS_START_Y);
-    gfx.printf(coordFormat, fluidnc.wposX);
+static void drawDroValue(DigitField& field, float value, LovyanGFX& dst = gfx, int16_t dy = 0) {
+  char text[DIGIT_FIELD_MAX + 1];
+  snprintf(text, sizeof(text), cfg.coord_decimal_places == 3 ? "%9.3f" : "%8.2f", value);
+  drawDigits(field, text, COLOR_VALUE, dst, dy);
+}
 
-    coordFormat[0] = 'Y';
-    gfx.setCursor(AlignmentLayout::COORD_4AXIS_START_X, AlignmentLayout::COORD_4AXIS_START_Y + AlignmentLayout::COORD_4AXIS_SPACING);
-    gfx.printf(coordFormat, fluidnc.wposY);
+// Detect if 4-axis machine (if A-axis is non-zero or moving)
+static bool alignmentHas4Axes(float posA, float wposA) {
+  return posA != 0 || wposA != 0;
+}
 
-    coordFormat[0] = 'Z';
-    gfx.setCursor(AlignmentLayout::COORD_4AXIS_START_X, AlignmentLayout::COORD_4AXIS_START_Y + 2 * AlignmentLayout::COORD_4AXIS_SPACING);
-    gfx.printf(coordFormat, fluidnc.wposZ);
+static bool alignmentHas4Axes() {
+  return alignmentHas4Axes(fluidncView.posA, fluidncView.wposA);
+}
 
-    coordFormat[0] = 'A';
-    gfx.setCursor(AlignmentLayout::COORD_4AXIS_START_X, AlignmentLayout::COORD_4AXIS_START_Y + 3 * AlignmentLayout::COORD_4AXIS_SPACING);
-    gfx.printf(coordFormat, fluidnc.wposA);
+static bool alignmentHas4Axes(const FrameContext& frame) {
+  return alignmentHas4Axes(frame.pos[3], frame.wpos[3]);
+}
 
-    // Small info footer for 4-axis
-    gfx.setTextSize(AlignmentLayout::MACHINE_POS_FONT_SIZE);
-    gfx.setTextColor(COLOR_LINE);
-    gfx.setCursor(AlignmentLayout::MACHINE_POS_X, AlignmentLayout::MACHINE_POS_Y);
-    gfx.printf("Machine: X:%.1f Y:%.1f Z:%.1f A:%.1f", fluidnc.posX, fluidnc.posY, fluidnc.posZ, fluidnc.posA);
-  } else {
-    // 3-AXIS DISPLAY - Original large size
-    gfx.setTextSize(AlignmentLayout::COORD_3AXIS_FONT_SIZE);
-    gfx.setTextColor(COLOR_VALUE);
+void drawAlignmentChrome(LovyanGFX& dst, int16_t dy, const FrameContext& frame) {
+  // Header
+  dst.fillRect(0, dy, SCREEN_WIDTH, CommonLayout::HEADER_HEIGHT, COLOR_HEADER);
+  dst.setTextColor(COLOR_TEXT);
+  dst.setTextSize(AlignmentLayout::TITLE_FONT_SIZE);
+  dst.setCursor(AlignmentLayout::TITLE_X, AlignmentLayout::TITLE_Y + dy);
+  dst.print("ALIGNMENT MODE");
+
+  dst.drawFastHLine(0, CommonLayout::HEADER_HEIGHT + dy, SCREEN_WIDTH, COLOR_LINE);
 
-    char coordFormat[20];
-    if (cfg.coord_decimal_places == 3) {
-      strcpy(coordFormat, "X:%9.3f");
+  // Title
+  dst.setTextSize(AlignmentLayout::SUBTITLE_FONT_SIZE);
+  dst.setTextColor(COLOR_HEADER);
+  dst.setCursor(AlignmentLayout::SUBTITLE_X, AlignmentLayout::SUBTITLE_Y + dy);
+  dst.print("WORK POSITION");
+
+  // Axis labels
+  bool has4Axes = alignmentHas4Axes(frame);
+  uint8_t axisCount = has4Axes ? 4 : 3;
+  const char* axisLabels[] = {"X:", "Y:", "Z:", "A:"};
+
+  dst.setTextColor(COLOR_VALUE);
+  for (uint8_t axis = 0; axis < axisCount; axis++) {
+    if (has4Axes) {
+      dst.setTextSize(AlignmentLayout::COORD_4AXIS_FONT_SIZE);
+      dst.setCursor(AlignmentLayout::COORD_4AXIS_START_X, AlignmentLayout::COORD_4AXIS_START_Y + axis * AlignmentLayout::COORD_4AXIS_SPACING + dy);
     } else {
-      strcpy(coordFormat, "X:%8.2f");
+      dst.setTextSize(AlignmentLayout::COORD_3AXIS_FONT_SIZE);
+      dst.setCursor(AlignmentLayout::COORD_3AXIS_START_X, AlignmentLayout::COORD_3AXIS_START_Y + axis * AlignmentLayout::COORD_3AXIS_SPACING + dy);
     }
+    dst.print(axisLabels[axis]);
+  }
+}
+
+uint32_t alignmentChromeKey() {
+  return alignmentHas4Axes() ? 4 : 3;
+}
+
+void drawAlignmentMode() {
+  FrameContext frame;
+  captureFrameContext(frame, ALIGNMENT_FRAME_NEEDS);
+  if (!pushChrome(MODE_ALIGNMENT)) {
+    gfx.fillScreen(COLOR_BG);
+    drawAlignmentChrome(gfx, 0, frame);
+  }
 
-    gfx.setCursor(AlignmentLayout::COORD_3AXIS_START_X, AlignmentLayout::COORD_3AXIS_START_Y);
-    gfx.printf(coordFormat, fluidnc.wposX);
+  // Interpolated between reports - see motion_estimator.h
+  updateMotionEstimator();
+  estimateWorkPosition(frame.wpos);
 
-    coordFormat[0] = 'Y';
-    gfx.setCursor(AlignmentLayout::COORD_3AXIS_START_X, AlignmentLayout::COORD_3AXIS_START_Y + AlignmentLayout::COORD_3AXIS_SPACING);
-    gfx.printf(coordFormat, fluidnc.wposY);
+  drawAlignmentValues(gfx, 0, frame);
+  scheduleAlignmentFields();
+}
+
+void drawAlignmentValues(LovyanGFX& dst, int16_t dy, const FrameContext& frame) {
+  bool panel = (&dst == &gfx);
+  bool has4Axes = alignmentHas4Axes(frame);
 
-    coordFormat[0] = 'Z';
-    gfx.setCursor(AlignmentLayout::COORD_3AXIS_START_X, AlignmentLayout::COORD_3AXIS_START_Y + 2 * AlignmentLayout::COORD_3AXIS_SPACING);
-    gfx.printf(coordFormat, fluidnc.wposZ);
+  // On the panel these become the fields the "dro" field updates
+  DigitField snapshotFields[4];
+  DigitField* fields = panel ? droFields : snapshotFields;
+  if (panel) {
+    droHas4Axes = has4Axes;
+  }
+  initDroFields(fields, has4Axes);
+  uint8_t axisCount = has4Axes ? 4 : 3;
+  for (uint8_t axis = 0; axis < axisCount; axis++) {
+    drawDroValue(fields[axis], frame.wpos[axis], dst, dy);
+  }
 
+  if (has4Axes) {
+    // Small info footer for 4-axis
+    dst.setTextSize(AlignmentLayout::MACHINE_POS_FONT_SIZE);
+    dst.setTextColor(COLOR_LINE);
+    dst.setCursor(AlignmentLayout::MACHINE_POS_X, AlignmentLayout::MACHINE_POS_Y + dy);
+    dst.printf("Machine: X:%.1f Y:%.1f Z:%.1f A:%.1f", frame.pos[0], frame.pos[1], frame.pos[2], frame.pos[3]);
+  } else {
     // Small info footer for 3-axis
-    gfx.setTextSize(AlignmentLayout::MACHINE_POS_FONT_SIZE);
-    gfx.setTextColor(COLOR_LINE);
-    gfx.setCursor(AlignmentLayout::MACHINE_POS_X, 270);
-    gfx.printf("Machine: X:%.1f Y:%.1f Z:%.1f", fluidnc.posX, fluidnc.posY, fluidnc.posZ);
+    dst.setTextSize(AlignmentLayout::MACHINE_POS_FONT_SIZE);
+    dst.setTextColor(COLOR_LINE);
+    dst.setCursor(AlignmentLayout::MACHINE_POS_X, 270 + dy);
+    dst.printf("Machine: X:%.1f Y:%.1f Z:%.1f", frame.pos[0], frame.pos[1], frame.pos[2]);
   }
 
   // Status line (same for both)
-  gfx.setCursor(AlignmentLayout::MACHINE_POS_X, 285);
-  if (fluidnc.machineState == "RUN") gfx.setTextColor(COLOR_GOOD);
-  else if (fluidnc.machineState == "ALARM") gfx.setTextColor(COLOR_WARN);
-  else gfx.setTextColor(COLOR_VALUE);
-  gfx.printf("Status: %s", fluidnc.machineState.c_str());
+  dst.setCursor(AlignmentLayout::MACHINE_POS_X, 285 + dy);
+  if (frame.machineState == MACHINE_RUN) dst.setTextColor(COLOR_GOOD);
+  else if (frame.machineState == MACHINE_ALARM) dst.setTextColor(COLOR_WARN);
+  else dst.setTextColor(COLOR_VALUE);
+  dst.printf("Status: %s", frame.stateText);
 
-  float maxTemp = sensors.temperatures[0];
+  float maxTemp = frame.temperatures[0];
   for (int i = 1; i < 4; i++) {
-    if (sensors.temperatures[i] > maxTemp) maxTemp = sensors.temperatures[i];
+    if (frame.temperatures[i] > maxTemp) maxTemp = frame.temperatures[i];
   }
 
-  gfx.setTextColor(maxTemp > cfg.temp_threshold_high ? COLOR_WARN : COLOR_LINE);
-  gfx.setCursor(AlignmentLayout::MACHINE_POS_X, 300);
-  gfx.printf("Temps:%.0f%s  Fan:%d%%  PSU:%.1fV",
+  dst.setTextColor(maxTemp > cfg.temp_threshold_high ? COLOR_WARN : COLOR_LINE);
+  dst.setCursor(AlignmentLayout::MACHINE_POS_X, 300 + dy);
+  dst.printf("Temps:%.0f%s  Fan:%d%%  PSU:%.1fV",
              convertTemp(maxTemp),
              cfg.use_fahrenheit ? "F" : "C",
-             sensors.fanSpeed,
-             sensors.psuVoltage);
+             frame.fanSpeed,
+             frame.psuVoltage);
 }
 
-void updateAlignmentMode() {
-  // Detect if 4-axis machine
-  bool has4Axes = (fluidnc.posA != 0 || fluidnc.wposA != 0);
-
-  if (has4Axes) {
-    // 4-AXIS UPDATE
-    gfx.setTextSize(AlignmentLayout::COORD_4AXIS_FONT_SIZE);
-    gfx.setTextColor(COLOR_VALUE);
-
-    char coordFormat[20];
-    if (cfg.coord_decimal_places == 3) {
-      strcpy(coordFormat, "%9.3f");
-    } else {
-      strcpy(coordFormat, "%8.2f");
-    }
+// ========== Alignment Fields ==========
 
-    // Update X
-    gfx.fillRect(140, AlignmentLayout::COORD_4AXIS_START_Y, 330, 32, COLOR_BG);
-    gfx.setCursor(140, AlignmentLayout::COORD_4AXIS_START_Y);
-    gfx.printf(coordFormat, fluidnc.wposX);
+// Work-position digits only - every DRO_UPDATE_INTERVAL
+static void drawAlignmentDRO() {
+  bool has4Axes = alignmentHas4Axes();
+  if (has4Axes != droHas4Axes) {
+    drawAlignmentMode();  // Axis count changed - different layout
+    return;
+  }
 
-    // Update Y
-    gfx.fillRect(140, AlignmentLayout::COORD_4AXIS_START_Y + AlignmentLayout::COORD_4AXIS_SPACING, 330, 32, COLOR_BG);
-    gfx.setCursor(140, AlignmentLayout::COORD_4AXIS_START_Y + AlignmentLayout::COORD_4AXIS_SPACING);
-    gfx.printf(coordFormat, fluidnc.wposY);
+  updateMotionEstimator();
+  float wpos[4];
+  estimateWorkPosition(wpos);
 
-    // Update Z
-    gfx.fillRect(140, AlignmentLayout::COORD_4AXIS_START_Y + 2 * AlignmentLayout::COORD_4AXIS_SPACING, 330, 32, COLOR_BG);
-    gfx.setCursor(140, AlignmentLayout::COORD_4AXIS_START_Y + 2 * AlignmentLayout::COORD_4AXIS_SPACING);
-    gfx.printf(coordFormat, fluidnc.wposZ);
+  uint8_t axisCount = has4Axes ? 4 : 3;
+  for (uint8_t axis = 0; axis < axisCount; axis++) {
+    drawDroValue(droFields[axis], wpos[axis]);
+  }
+}
 
-    // Update A
-    gfx.fillRect(140, AlignmentLayout::COORD_4AXIS_START_Y + 3 * AlignmentLayout::COORD_4AXIS_SPACING, 330, 32, COLOR_BG);
-    gfx.setCursor(140, AlignmentLayout::COORD_4AXIS_START_Y + 3 * AlignmentLayout::COORD_4AXIS_SPACING);
-    gfx.printf(coordFormat, fluidnc.wposA);
+// Machine position, status and temperature lines share the cleared footer
+static void drawAlignmentFooter() {
+  bool has4Axes = droHas4Axes;
 
+  if (has4Axes) {
     // Update footer
     gfx.setTextSize(AlignmentLayout::MACHINE_POS_FONT_SIZE);
     gfx.fillRect(90, AlignmentLayout::MACHINE_POS_Y, 390, 40, COLOR_BG);
 
     gfx.setTextColor(COLOR_LINE);
     gfx.setCursor(90, AlignmentLayout::MACHINE_POS_Y);
-    gfx.printf("X:%.1f Y:%.1f Z:%.1f A:%.1f", fluidnc.posX, fluidnc.posY, fluidnc.posZ, fluidnc.posA);
+    gfx.printf("X:%.1f Y:%.1f Z:%.1f A:%.1f", fluidncView.posX, fluidncView.posY, fluidncView.posZ, fluidncView.posA);
   } else {
-    // 3-AXIS UPDATE - Original code
-    gfx.setTextSize(AlignmentLayout::COORD_3AXIS_FONT_SIZE);
-    gfx.setTextColor(COLOR_VALUE);
-
-    char coordFormat[20];
-    if (cfg.coord_decimal_places == 3) {
-      strcpy(coordFormat, "%9.3f");
-    } else {
-      strcpy(coordFormat, "%8.2f");
-    }
-
-    gfx.fillRect(150, AlignmentLayout::COORD_3AXIS_START_Y, 320, 38, COLOR_BG);
-    gfx.setCursor(150, AlignmentLayout::COORD_3AXIS_START_Y);
-    gfx.printf(coordFormat, fluidnc.wposX);
-
-    gfx.fillRect(150, AlignmentLayout::COORD_3AXIS_START_Y + AlignmentLayout::COORD_3AXIS_SPACING, 320, 38, COLOR_BG);
-    gfx.setCursor(150, AlignmentLayout::COORD_3AXIS_START_Y + AlignmentLayout::COORD_3AXIS_SPACING);
-    gfx.printf(coordFormat, fluidnc.wposY);
-
-    gfx.fillRect(150, AlignmentLayout::COORD_3AXIS_START_Y + 2 * AlignmentLayout::COORD_3AXIS_SPACING, 320, 38, COLOR_BG);
-    gfx.setCursor(150, AlignmentLayout::COORD_3AXIS_START_Y + 2 * AlignmentLayout::COORD_3AXIS_SPACING);
-    gfx.printf(coordFormat, fluidnc.wposZ);
-
     // Update footer
     gfx.setTextSize(AlignmentLayout::MACHINE_POS_FONT_SIZE);
     gfx.fillRect(90, 270, 390, 35, COLOR_BG);
 
     gfx.setTextColor(COLOR_LINE);
     gfx.setCursor(90, 270);
-    gfx.printf("X:%.1f Y:%.1f Z:%.1f", fluidnc.posX, fluidnc.posY, fluidnc.posZ);
+    gfx.printf("X:%.1f Y:%.1f Z:%.1f", fluidncView.posX, fluidncView.posY, fluidncView.posZ);
   }
 
   // Update status (same for both)
   gfx.setCursor(80, 285);
-  if (fluidnc.machineState == "RUN") gfx.setTextColor(COLOR_GOOD);
-  else if (fluidnc.machineState == "ALARM") gfx.setTextColor(COLOR_WARN);
+  if (fluidncView.machineState == MACHINE_RUN) gfx.setTextColor(COLOR_GOOD);
+  else if (fluidncView.machineState == MACHINE_ALARM) gfx.setTextColor(COLOR_WARN);
   else gfx.setTextColor(COLOR_VALUE);
-  gfx.printf("%s", fluidnc.machineState.c_str());
+  gfx.printf("%s", fluidncView.stateText);
 
   float maxTemp = sensors.temperatures[0];
   for (int i = 1; i < 4; i++) {
@@ -215,3 +227,18 @@ void updateAlignmentMode() {
              sensors.fanSpeed,
              sensors.psuVoltage);
 }
+
+static uint32_t footerVersion() {
+  return fluidncVersionOf(fluidncView, FNC_CHG_MPOS | FNC_CHG_STATE) +
+         sensors.tempVersion + sensors.readingVersion;
+}
+
+static RenderField alignmentFields[] = {
+  // name     period               version        draw
+  {"dro",     DRO_UPDATE_INTERVAL, nullptr,       drawAlignmentDRO,    0, 0},
+  {"footer",  250,                 footerVersion, drawAlignmentFooter, 0, 0},
+};
+
+static void scheduleAlignmentFields() {
+  setRenderFields(alignmentFields, sizeof(alignmentFields) / sizeof(alignmentFields[0]));
+}
@@ -2,6 +2,7 @@
 #include "state/global_state.h"
 #include "display.h"
 #include "config/config.h"
+#include "input/input_events.h"
 #include <Wire.h>
 #include <RTClib.h>
 #include <WiFi.h>
@@ -15,77 +16,60 @@ void setupWebServer();
 void enterSetupMode();
 const char* getMonthName(int month);
 
-// ========== HELPER FUNCTIONS ==========
-
-void drawTempGraph(int x, int y, int w, int h) {
-  gfx.fillRect(x, y, w, h, COLOR_BG);
-  gfx.drawRect(x, y, w, h, COLOR_LINE);
-
-  float minTemp = 10.0;
-  float maxTemp = 60.0;
-
-  // Draw temperature line
-  for (int i = 1; i < history.historySize; i++) {
-    int idx1 = (history.historyIndex + i - 1) % history.historySize;
-    int idx2 = (history.historyIndex + i) % history.historySize;
-
-    float temp1 = history.tempHistory[idx1];
-    float temp2 = history.tempHistory[idx2];
-
-    int x1 = x + ((i - 1) * w / history.historySize);
-    int y1 = y + h - ((temp1 - minTemp) / (maxTemp - minTemp) * h);
-    int x2 = x + (i * w / history.historySize);
-    int y2 = y + h - ((temp2 - minTemp) / (maxTemp - minTemp) * h);
-
-    y1 = constrain(y1, y, y + h);
-    y2 = constrain(y2, y, y + h);
+// ========== BUTTON HANDLING ==========
 
-    // Color based on temperature
-    uint16_t color;
-    if (temp2 > cfg.temp_threshold_high) color = COLOR_WARN;
-    else if (temp2 > cfg.temp_threshold_low) color = COLOR_ORANGE;
-    else color = COLOR_GOOD;
+// Button edges arrive from the GPIO interrupt (input_events.h). A bounce
+// burst is accepted once the level has been stable for BUTTON_DEBOUNCE_MS,
+// dated by its first edge so press durations are exact.
+static bool buttonLevel = false;          // Level after the latest edge (true = down)
+static bool buttonSettling = false;
+static unsigned long burstStart = 0;
+static unsigned long lastEdge = 0;
 
-    gfx.drawLine(x1, y1, x2, y2, color);
+void handleButton() {
+  InputEvent event;
+  while (nextButtonEvent(event)) {
+    if (!buttonSettling) {
+      buttonSettling = true;
+      burstStart = event.time;
+    }
+    lastEdge = event.time;
+    buttonLevel = (event.type == INPUT_BUTTON_DOWN);
   }
 
-  // Scale markers
-  gfx.setTextSize(1);
-  gfx.setTextColor(COLOR_LINE);
-  gfx.setCursor(x + 3, y + 2);
-  gfx.print("60");
-  gfx.setCursor(x + 3, y + h / 2 - 5);
-  gfx.print("35");
-  gfx.setCursor(x + 3, y + h - 10);
-  gfx.print("10");
-}
-
-// ========== BUTTON HANDLING ==========
-
-void handleButton() {
-  bool currentState = (digitalRead(BTN_MODE) == LOW);
+  if (buttonSettling && millis() - lastEdge >= BUTTON_DEBOUNCE_MS) {
+    buttonSettling = false;
 
-  if (currentState && !timing.buttonPressed) {
-    timing.buttonPressed = true;
-    timing.buttonPressStart = millis();
-  }
-  else if (!currentState && timing.buttonPressed) {
-    unsigned long pressDuration = millis() - timing.buttonPressStart;
-    timing.buttonPressed = false;
-
-    if (pressDuration >= 5000) {
-      enterSetupMode();
-    } else if (pressDuration < 1000) {
-      cycleDisplayMode();
+    if (buttonLevel && !timing.buttonPressed) {
+      timing.buttonPressed = true;
+      timing.buttonPressStart = burstStart;
+    }
+    else if (!buttonLevel && timing.buttonPressed) {
+      unsigned long pressDuration = burstStart - timing.buttonPressStart;
+      timing.buttonPressed = false;
+
+      if (pressDuration >= 5000) {
+        enterSetupMode();
+      } else if (pressDuration < 1000) {
+        cycleDisplayMode();
+      }
+      return;
     }
   }
-  else if (timing.buttonPressed && (millis() - timing.buttonPressStart >= 2000)) {
+
+  if (timing.buttonPressed && (millis() - timing.buttonPressStart >= 2000)) {
     showHoldProgress();
   }
 }
 
+// Mode-name banner shown over the new screen after a button press;
+// serviceModeBanner() redraws the screen once it has been up MODE_BANNER_MS
+#define MODE_BANNER_MS 800
+static bool bannerShown = false;
+static unsigned long bannerStart = 0;
+
 void cycleDisplayMode() {
-  currentMode = (DisplayMode)((currentMode + 1) % 4);  // Now we have 4 modes
+  currentMode = nextDisplayMode(currentMode);
   drawScreen();
 
   // Flash mode name
@@ -99,10 +83,19 @@ void cycleDisplayMode() {
     case MODE_ALIGNMENT: gfx.print("ALIGNMENT"); break;
     case MODE_GRAPH: gfx.print("GRAPH"); break;
     case MODE_NETWORK: gfx.print("NETWORK"); break;
+    case MODE_STORAGE: gfx.print("STORAGE"); break;
+    case MODE_DRO: gfx.print("DRO"); break;
+    default: break;
   }
 
-  delay(800);
-  drawScreen();
+  bannerShown = true;
+  bannerStart = millis();
+}
+
+void serviceModeBanner() {
+  if (!bannerShown || millis() - bannerStart < MODE_BANNER_MS) return;
+  bannerShown = false;
+  drawScreen();  // The current screen's chrome is still cached - a fast push
 }
 
 void showHoldProgress() {
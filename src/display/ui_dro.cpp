@@ -0,0 +1,57 @@
+#include "ui_modes.h"
+#include "state/global_state.h"
+#include "display.h"
+#include "screen_renderer.h"
+#include "render_scheduler.h"
+#include "config/config.h"
+
+// ========== DRO MODE ==========
+// The JSON-defined screen at DRO_SCREEN_PATH - a user file on SD/LittleFS,
+// otherwise the copy of layouts/dro.json built into the firmware
+// (builtin_layouts.h). It is loaded once into activeLayout; after the full
+// draw only changed elements are repainted.
+
+static void scheduleDroFields();
+
+static void drawMissingLayout() {
+  gfx.fillScreen(COLOR_BG);
+  gfx.setTextColor(COLOR_WARN);
+  gfx.setTextSize(2);
+  gfx.setCursor(10, 10);
+  gfx.print("No screen layout");
+  gfx.setTextColor(COLOR_TEXT);
+  gfx.setTextSize(1);
+  gfx.setCursor(10, 40);
+  gfx.print(DRO_SCREEN_PATH);
+}
+
+void drawDroMode() {
+  if (!layoutsLoaded) {
+    loadScreenConfig(DRO_SCREEN_PATH, activeLayout);
+    layoutsLoaded = true;  // Don't retry the SD card on every redraw
+  }
+
+  if (!activeLayout.isValid) {
+    drawMissingLayout();
+    setRenderFields(nullptr, 0);
+    return;
+  }
+
+  drawScreenFromLayout(activeLayout);
+  scheduleDroFields();
+}
+
+// ========== DRO Fields ==========
+
+static void drawDroValues() {
+  updateScreenFromLayout(activeLayout);
+}
+
+static RenderField droFields[] = {
+  // name     period  version  draw
+  {"layout",  100,    nullptr, drawDroValues, 0, 0},
+};
+
+static void scheduleDroFields() {
+  setRenderFields(droFields, sizeof(droFields) / sizeof(droFields[0]));
+}
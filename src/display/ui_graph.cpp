@@ -2,6 +2,10 @@
 #include "ui_layout.h"
 #include "state/global_state.h"
 #include "display.h"
+#include "temp_graph.h"
+#include "render_scheduler.h"
+#include "chrome_cache.h"
+#include "screen_renderer.h"
 #include "config/config.h"
 
 // External variables from main.cpp
@@ -10,15 +14,15 @@ extern int cfg_graph_timespan_seconds;
 
 // ========== GRAPH MODE ==========
 
-void drawGraphMode() {
-  gfx.fillScreen(COLOR_BG);
+static void scheduleGraphFields();
 
+void drawGraphChrome(LovyanGFX& dst, int16_t dy, const FrameContext& frame) {
   // Header
-  gfx.fillRect(0, 0, SCREEN_WIDTH, CommonLayout::HEADER_HEIGHT, COLOR_HEADER);
-  gfx.setTextColor(COLOR_TEXT);
-  gfx.setTextSize(GraphLayout::TITLE_FONT_SIZE);
-  gfx.setCursor(GraphLayout::TITLE_X, GraphLayout::TITLE_Y);
-  gfx.print("TEMPERATURE HISTORY");
+  dst.fillRect(0, dy, SCREEN_WIDTH, CommonLayout::HEADER_HEIGHT, COLOR_HEADER);
+  dst.setTextColor(COLOR_TEXT);
+  dst.setTextSize(GraphLayout::TITLE_FONT_SIZE);
+  dst.setCursor(GraphLayout::TITLE_X, GraphLayout::TITLE_Y + dy);
+  dst.print("TEMPERATURE HISTORY");
 
   char timeLabel[40];
   if (cfg.graph_timespan_seconds >= 60) {
@@ -26,17 +30,53 @@ void drawGraphMode() {
   } else {
     sprintf(timeLabel, " - %d seconds", cfg.graph_timespan_seconds);
   }
-  gfx.setTextSize(GraphLayout::TIMESPAN_LABEL_FONT_SIZE);
-  gfx.setCursor(GraphLayout::TIMESPAN_LABEL_X, GraphLayout::TIMESPAN_LABEL_Y);
-  gfx.print(timeLabel);
+  dst.setTextSize(GraphLayout::TIMESPAN_LABEL_FONT_SIZE);
+  dst.setCursor(GraphLayout::TIMESPAN_LABEL_X, GraphLayout::TIMESPAN_LABEL_Y + dy);
+  dst.print(timeLabel);
+
+  dst.drawFastHLine(0, CommonLayout::HEADER_HEIGHT + dy, SCREEN_WIDTH, COLOR_LINE);
+}
+
+uint32_t graphChromeKey() {
+  return cfg.graph_timespan_seconds;
+}
 
-  gfx.drawFastHLine(0, CommonLayout::HEADER_HEIGHT, SCREEN_WIDTH, COLOR_LINE);
+void drawGraphMode() {
+  FrameContext frame;
+  captureFrameContext(frame, GRAPH_FRAME_NEEDS);
+  if (!pushChrome(MODE_GRAPH)) {
+    gfx.fillScreen(COLOR_BG);
+    drawGraphChrome(gfx, 0, frame);
+  }
 
+  drawGraphValues(gfx, 0, frame);
+  scheduleGraphFields();
+}
+
+void drawGraphValues(LovyanGFX& dst, int16_t dy, const FrameContext& frame) {
   // Full screen graph
-  drawTempGraph(GraphLayout::GRAPH_X, GraphLayout::GRAPH_Y, GraphLayout::GRAPH_WIDTH, GraphLayout::GRAPH_HEIGHT);
+  if (&dst == &gfx) {
+    drawTempGraph(GraphLayout::GRAPH_X, GraphLayout::GRAPH_Y, GraphLayout::GRAPH_WIDTH, GraphLayout::GRAPH_HEIGHT);
+  } else if (frame.history != nullptr) {
+    drawTempGraphCopy(dst, dy, *frame.history,
+                      GraphLayout::GRAPH_X, GraphLayout::GRAPH_Y, GraphLayout::GRAPH_WIDTH, GraphLayout::GRAPH_HEIGHT);
+  }
 }
 
-void updateGraphMode() {
-  // Redraw graph
-  drawTempGraph(GraphLayout::GRAPH_X, GraphLayout::GRAPH_Y, GraphLayout::GRAPH_WIDTH, GraphLayout::GRAPH_HEIGHT);
+// ========== Graph Fields ==========
+
+static void drawGraphSamples() {
+  // Draw new samples (scrolls when the window moves a column)
+  updateTempGraph(GraphLayout::GRAPH_X, GraphLayout::GRAPH_Y, GraphLayout::GRAPH_WIDTH, GraphLayout::GRAPH_HEIGHT);
+}
+
+static uint32_t graphVersion() { return tempGraphVersion(); }
+
+static RenderField graphFields[] = {
+  // name     period  version       draw
+  {"graph",   500,    graphVersion, drawGraphSamples, 0, 0},
+};
+
+static void scheduleGraphFields() {
+  setRenderFields(graphFields, sizeof(graphFields) / sizeof(graphFields[0]));
 }
@@ -47,6 +47,8 @@ namespace MonitorLayout {
     constexpr int PEAK_TEMP_X = 140;
     constexpr int PEAK_TEMP_Y_OFFSET = 2;        // Offset from row Y position
     constexpr int PEAK_TEMP_FONT_SIZE = 1;
+    constexpr int PEAK_TEMP_WIDTH = 90;          // Peak text area to redraw
+    constexpr int PEAK_TEMP_HEIGHT = 8;
 
     // Bottom status section
     constexpr int STATUS_LABEL_X = 10;
@@ -87,12 +89,14 @@ namespace AlignmentLayout {
     constexpr int COORD_3AXIS_START_Y = 90;
     constexpr int COORD_3AXIS_SPACING = 65;
     constexpr int COORD_3AXIS_FONT_SIZE = 5;
+    constexpr int COORD_3AXIS_VALUE_X = 150;    // Digits only (after the "X:" label)
 
     // 4-axis display (compact coordinates)
     constexpr int COORD_4AXIS_START_X = 40;
     constexpr int COORD_4AXIS_START_Y = 75;
     constexpr int COORD_4AXIS_SPACING = 45;
     constexpr int COORD_4AXIS_FONT_SIZE = 4;
+    constexpr int COORD_4AXIS_VALUE_X = 140;
 
     // Machine position footer (4-axis only)
     constexpr int MACHINE_POS_Y = 265;
@@ -163,6 +167,9 @@ namespace NetworkLayout {
     constexpr int STATUS_SIGNAL_Y = 140;
     constexpr int STATUS_MDNS_Y = 165;
     constexpr int STATUS_FLUIDNC_Y = 190;
+    constexpr int STATUS_LINK_Y = 215;          // Optional (cfg.show_link_stats)
+    constexpr int STATUS_LINK_WIDTH = 400;
+    constexpr int STATUS_LINK_HEIGHT = 10;
     constexpr int STATUS_ROW_FONT_SIZE = 1;
 
     // Not connected display
@@ -2,13 +2,21 @@
 #include "state/global_state.h"
 #include "display.h"
 #include "config/config.h"
+#include "render_profiler.h"
+#include "render_scheduler.h"
+#include "chrome_cache.h"
 
 // External variables from main.cpp
 extern Config cfg;
 extern DisplayMode currentMode;
 
 // ========== MAIN DISPLAY CONTROL ==========
+DisplayMode nextDisplayMode(DisplayMode mode) {
+    return (DisplayMode)((mode + 1) % MODE_COUNT);
+}
+
 void drawScreen() {
+    perfBeginFrame();
     switch(currentMode) {
         case MODE_MONITOR:
             drawMonitorMode();
@@ -25,25 +33,27 @@ void drawScreen() {
         case MODE_STORAGE:
             drawStorageMode();
             break;
+        case MODE_DRO:
+            drawDroMode();
+            break;
+        default:
+            break;
     }
+    perfEndFrame(currentMode, PERF_DRAW);
+    drawPerfOverlay(currentMode, true);
+
+    // Where the button or a footer tap goes next - rendered while idle
+    prepareChrome(nextDisplayMode(currentMode));
 }
 
 void updateDisplay() {
-    switch(currentMode) {
-        case MODE_MONITOR:
-            updateMonitorMode();
-            break;
-        case MODE_ALIGNMENT:
-            updateAlignmentMode();
-            break;
-        case MODE_GRAPH:
-            updateGraphMode();
-            break;
-        case MODE_NETWORK:
-            updateNetworkMode();
-            break;
-        case MODE_STORAGE:
-            updateStorageMode();
-            break;
+    serviceModeBanner();
+
+    perfBeginFrame();
+    if (serviceRenderFields() == 0) {
+        serviceChromeCache();  // Idle pass - one band of the next screen
+        return;  // Nothing was due - not worth a profiler sample
     }
+    perfEndFrame(currentMode, PERF_UPDATE);
+    drawPerfOverlay(currentMode);
 }
@@ -1,26 +1,53 @@
 #ifndef UI_MODES_H
 #define UI_MODES_H
 
+#include <LovyanGFX.hpp>
+#include "config/config.h"
+
 // Display mode functions
 void drawScreen();
-void updateDisplay();
+void updateDisplay();       // Every loop() pass - repaints due fields only
+
+// The mode after 'mode' - the button and the footer tap both cycle through
+// it, and drawScreen() pre-renders its chrome (chrome_cache.h)
+DisplayMode nextDisplayMode(DisplayMode mode);
 
-// Mode drawing functions
+// Mode drawing functions. Each full redraw registers the screen's dynamic
+// fields with the render scheduler (render_scheduler.h).
 void drawMonitorMode();
-void updateMonitorMode();
 void drawAlignmentMode();
-void updateAlignmentMode();
 void drawGraphMode();
-void updateGraphMode();
 void drawNetworkMode();
-void updateNetworkMode();
 void drawStorageMode();
-void updateStorageMode();
+void drawDroMode();          // activeLayout, kept current by updateScreenFromLayout()
+
+struct FrameContext;
+
+// Static chrome of the screens the chrome cache pre-renders
+// (chrome_cache.h); dy is added to every y coordinate
+void drawMonitorChrome(LovyanGFX& dst, int16_t dy, const FrameContext& frame);
+void drawAlignmentChrome(LovyanGFX& dst, int16_t dy, const FrameContext& frame);
+void drawGraphChrome(LovyanGFX& dst, int16_t dy, const FrameContext& frame);
+uint32_t monitorChromeKey();
+uint32_t alignmentChromeKey();
+uint32_t graphChromeKey();
+
+// Values of a full redraw, on top of the chrome. On the panel they also
+// prime the fields the render scheduler updates; on any other target
+// (screen_snapshot.h) they are drawn from 'frame' alone.
+void drawMonitorValues(LovyanGFX& dst, int16_t dy, const FrameContext& frame);
+void drawAlignmentValues(LovyanGFX& dst, int16_t dy, const FrameContext& frame);
+void drawGraphValues(LovyanGFX& dst, int16_t dy, const FrameContext& frame);
+
+// FRAME_NEEDS_* of a built-in screen's chrome and values
+#define MONITOR_FRAME_NEEDS (FRAME_NEEDS_RTC | FRAME_NEEDS_SENSOR_NAMES)
+#define ALIGNMENT_FRAME_NEEDS 0
+#define GRAPH_FRAME_NEEDS 0
 
 // Helper functions
-void drawTempGraph(int x, int y, int w, int h);
 void handleButton();
 void cycleDisplayMode();
+void serviceModeBanner();   // Takes the mode-name banner down when it expires
 void showHoldProgress();
 
 #endif // UI_MODES_H
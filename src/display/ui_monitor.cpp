@@ -4,6 +4,13 @@
 #include "display.h"
 #include "config/config.h"
 #include "sensors/sensors.h"
+#include "region_compositor.h"
+#include "temp_graph.h"
+#include "digit_atlas.h"
+#include "render_scheduler.h"
+#include "chrome_cache.h"
+#include "layout_cache.h"
+#include "screen_renderer.h"
 #include <Wire.h>
 #include <RTClib.h>
 
@@ -22,162 +29,208 @@ inline float convertTemp(float celsius) {
 
 // ========== MONITOR MODE ==========
 
-void drawMonitorMode() {
-  gfx.fillScreen(COLOR_BG);
+static void scheduleMonitorFields();
+
+// Temperature values on screen, drawn from the digit atlas
+static DigitField tempFields[4];
 
+void drawMonitorChrome(LovyanGFX& dst, int16_t dy, const FrameContext& frame) {
   // Header
-  gfx.fillRect(0, 0, SCREEN_WIDTH, CommonLayout::HEADER_HEIGHT, COLOR_HEADER);
-  gfx.setTextColor(COLOR_TEXT);
-  gfx.setTextSize(MonitorLayout::HEADER_FONT_SIZE);
-  gfx.setCursor(MonitorLayout::HEADER_TITLE_X, MonitorLayout::HEADER_TITLE_Y);
-  gfx.print("FluidDash");
+  dst.fillRect(0, dy, SCREEN_WIDTH, CommonLayout::HEADER_HEIGHT, COLOR_HEADER);
+  dst.setTextColor(COLOR_TEXT);
+  dst.setTextSize(MonitorLayout::HEADER_FONT_SIZE);
+  dst.setCursor(MonitorLayout::HEADER_TITLE_X, MonitorLayout::HEADER_TITLE_Y + dy);
+  dst.print("FluidDash");
+
+  // Dividers
+  dst.drawFastHLine(0, MonitorLayout::TOP_DIVIDER_Y + dy, SCREEN_WIDTH, COLOR_LINE);
+  dst.drawFastHLine(0, MonitorLayout::MIDDLE_DIVIDER_Y + dy, SCREEN_WIDTH, COLOR_LINE);
+  dst.drawFastVLine(MonitorLayout::VERTICAL_DIVIDER_X, MonitorLayout::TOP_DIVIDER_Y + dy, MonitorLayout::VERTICAL_DIVIDER_HEIGHT, COLOR_LINE);
+
+  // Left section - Driver temperature labels
+  dst.setTextSize(MonitorLayout::TEMP_LABEL_FONT_SIZE);
+  dst.setTextColor(COLOR_TEXT);
+  dst.setCursor(MonitorLayout::TEMP_SECTION_X, MonitorLayout::TEMP_LABEL_Y + dy);
+  dst.print("TEMPS:");
+
+  // Row labels (0=X, 1=YL, 2=YR, 3=Z): the mapped sensor's friendly name
+  // (truncated to 12 chars), or the default label
+  for (int pos = 0; pos < 4; pos++) {
+    int rowY = MonitorLayout::TEMP_START_Y + pos * MonitorLayout::TEMP_ROW_SPACING;
+    dst.setCursor(MonitorLayout::TEMP_LABEL_X, rowY + dy);
+    dst.print(frame.sensorNames[pos]);
+    dst.print(":");
+  }
+
+  // Status section
+  dst.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_LABEL_Y + dy);
+  dst.print("STATUS:");
+
+  // Right section - Temperature graph
+  dst.setCursor(MonitorLayout::GRAPH_LABEL_X, MonitorLayout::GRAPH_LABEL_Y + dy);
+  dst.print("TEMP HISTORY");
+
+  if (cfg.show_temp_graph) {
+    char graphLabel[40];
+    if (cfg.graph_timespan_seconds >= 60) {
+      sprintf(graphLabel, "(%d min)", cfg.graph_timespan_seconds / 60);
+    } else {
+      sprintf(graphLabel, "(%d sec)", cfg.graph_timespan_seconds);
+    }
+    dst.setCursor(MonitorLayout::GRAPH_LABEL_X, MonitorLayout::GRAPH_TIMESPAN_Y + dy);
+    dst.setTextColor(COLOR_LINE);
+    dst.print(graphLabel);
+  }
+}
+
+// Everything drawMonitorChrome() reads
+uint32_t monitorChromeKey() {
+  FrameContext frame;
+  captureFrameContext(frame, CHROME_FRAME_NEEDS);
+  uint32_t key = LAYOUT_HASH_SEED;
+  for (int pos = 0; pos < 4; pos++) {
+    key = layoutSourceHash(frame.sensorNames[pos], strlen(frame.sensorNames[pos]) + 1, key);
+  }
+  int graphSeconds = cfg.show_temp_graph ? cfg.graph_timespan_seconds : -1;
+  return layoutSourceHash((const char*)&graphSeconds, sizeof(graphSeconds), key);
+}
+
+void drawMonitorMode() {
+  FrameContext frame;
+  captureFrameContext(frame, MONITOR_FRAME_NEEDS);
+  if (!pushChrome(MODE_MONITOR)) {
+    gfx.fillScreen(COLOR_BG);
+    drawMonitorChrome(gfx, 0, frame);
+  }
+
+  drawMonitorValues(gfx, 0, frame);
+  scheduleMonitorFields();
+}
+
+void drawMonitorValues(LovyanGFX& dst, int16_t dy, const FrameContext& frame) {
+  bool panel = (&dst == &gfx);
 
   // DateTime in header (right side)
   char buffer[40];
-  if (network.rtcAvailable) {
-    DateTime now = rtc.now();
+  dst.setTextColor(COLOR_TEXT);
+  dst.setTextSize(MonitorLayout::HEADER_FONT_SIZE);
+  if (frame.rtcValid) {
     sprintf(buffer, "%s %02d  %02d:%02d:%02d",
-            getMonthName(now.month()), now.day(), now.hour(), now.minute(), now.second());
+            getMonthName(frame.now.month()), frame.now.day(), frame.now.hour(), frame.now.minute(), frame.now.second());
   } else {
     sprintf(buffer, "No RTC");
   }
-  gfx.setCursor(MonitorLayout::DATETIME_X, MonitorLayout::DATETIME_Y);
-  gfx.print(buffer);
-
-  // Dividers
-  gfx.drawFastHLine(0, MonitorLayout::TOP_DIVIDER_Y, SCREEN_WIDTH, COLOR_LINE);
-  gfx.drawFastHLine(0, MonitorLayout::MIDDLE_DIVIDER_Y, SCREEN_WIDTH, COLOR_LINE);
-  gfx.drawFastVLine(MonitorLayout::VERTICAL_DIVIDER_X, MonitorLayout::TOP_DIVIDER_Y, MonitorLayout::VERTICAL_DIVIDER_HEIGHT, COLOR_LINE);
-
-  // Left section - Driver temperatures
-  gfx.setTextSize(MonitorLayout::TEMP_LABEL_FONT_SIZE);
-  gfx.setTextColor(COLOR_TEXT);
-  gfx.setCursor(MonitorLayout::TEMP_SECTION_X, MonitorLayout::TEMP_LABEL_Y);
-  gfx.print("TEMPS:");
+  dst.setCursor(MonitorLayout::DATETIME_X, MonitorLayout::DATETIME_Y + dy);
+  dst.print(buffer);
 
-  // Default labels (used if no sensor mappings configured)
-  const char* defaultLabels[] = {"X:", "YL:", "YR:", "Z:"};
-
-  // Display driver temps by position (0=X, 1=YL, 2=YR, 3=Z)
+  // Display driver temps by position (0=X, 1=YL, 2=YR, 3=Z). The last
+  // DS18B20 pass already sorted them by display position - no bus access here.
   for (int pos = 0; pos < 4; pos++) {
     int rowY = MonitorLayout::TEMP_START_Y + pos * MonitorLayout::TEMP_ROW_SPACING;
-    gfx.setCursor(MonitorLayout::TEMP_LABEL_X, rowY);
-    gfx.setTextColor(COLOR_TEXT);
-
-    // Find sensor assigned to this display position
-    const SensorMapping* sensor = getSensorMappingByPosition(pos);
-    float currentTemp = 0.0;
-    float peakTemp = 0.0;
-
-    if (sensor) {
-      // Use sensor assigned to this position
-      currentTemp = getTempByUID(sensor->uid);
-      if (isnan(currentTemp)) currentTemp = 0.0;
-
-      // Get peak temp for this position
-      peakTemp = sensors.peakTemps[pos];
-
-      // Show friendly name (truncated to 12 chars)
-      char truncatedName[13];
-      strlcpy(truncatedName, sensor->friendlyName, sizeof(truncatedName));
-      gfx.print(truncatedName);
-      gfx.print(":");
-    } else {
-      // No sensor assigned - show default label and use fallback temps array
-      gfx.print(defaultLabels[pos]);
-      currentTemp = sensors.temperatures[pos];
-      peakTemp = sensors.peakTemps[pos];
-    }
+    float currentTemp = frame.temperatures[pos];
+    float peakTemp = frame.peakTemps[pos];
 
-    // Current temp
-    gfx.setTextSize(MonitorLayout::TEMP_VALUE_FONT_SIZE);
-    gfx.setTextColor(currentTemp > cfg.temp_threshold_high ? COLOR_WARN : COLOR_VALUE);
-    gfx.setCursor(MonitorLayout::TEMP_VALUE_X, rowY + MonitorLayout::TEMP_VALUE_Y_OFFSET);
-    sprintf(buffer, "%d%s", (int)currentTemp, cfg.use_fahrenheit ? "F" : "C");
-    gfx.print(buffer);
+    // Current temp - the panel's field is what the "temps" field updates
+    DigitField snapshotField;
+    DigitField& field = panel ? tempFields[pos] : snapshotField;
+    initDigitField(field, MonitorLayout::TEMP_VALUE_X, rowY + MonitorLayout::TEMP_VALUE_Y_OFFSET,
+                   MonitorLayout::TEMP_VALUE_FONT_SIZE, COLOR_BG);
+    snprintf(buffer, DIGIT_FIELD_MAX + 1, "%d%s", (int)convertTemp(currentTemp), cfg.use_fahrenheit ? "F" : "C");
+    drawDigits(field, buffer, currentTemp > cfg.temp_threshold_high ? COLOR_WARN : COLOR_VALUE, dst, dy);
 
     // Peak temp to the right
     if (peakTemp > 0.0) {
-      gfx.setTextSize(MonitorLayout::PEAK_TEMP_FONT_SIZE);
-      gfx.setTextColor(COLOR_LINE);
-      gfx.setCursor(MonitorLayout::PEAK_TEMP_X, rowY + MonitorLayout::PEAK_TEMP_Y_OFFSET);
-      sprintf(buffer, "pk:%d%s", (int)peakTemp, cfg.use_fahrenheit ? "F" : "C");
-      gfx.print(buffer);
+      dst.setTextSize(MonitorLayout::PEAK_TEMP_FONT_SIZE);
+      dst.setTextColor(COLOR_LINE);
+      dst.setCursor(MonitorLayout::PEAK_TEMP_X, rowY + MonitorLayout::PEAK_TEMP_Y_OFFSET + dy);
+      sprintf(buffer, "pk:%d%s", (int)convertTemp(peakTemp), cfg.use_fahrenheit ? "F" : "C");
+      dst.print(buffer);
     }
-
-    gfx.setTextSize(1);
   }
 
   // Status section
-  gfx.setTextColor(COLOR_TEXT);
-  gfx.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_LABEL_Y);
-  gfx.print("STATUS:");
-
-  gfx.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_FAN_Y);
-  gfx.setTextColor(COLOR_LINE);
-  sprintf(buffer, "Fan: %d%% (%dRPM)", sensors.fanSpeed, sensors.fanRPM);
-  gfx.print(buffer);
-
-  gfx.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_PSU_Y);
-  sprintf(buffer, "PSU: %.1fV", sensors.psuVoltage);
-  gfx.print(buffer);
-
-  gfx.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_FLUIDNC_Y);
-  if (fluidnc.connected) {
-    if (fluidnc.machineState == "RUN") gfx.setTextColor(COLOR_GOOD);
-    else if (fluidnc.machineState == "ALARM") gfx.setTextColor(COLOR_WARN);
-    else gfx.setTextColor(COLOR_VALUE);
-    sprintf(buffer, "FluidNC: %s", fluidnc.machineState.c_str());
+  dst.setTextSize(MonitorLayout::STATUS_LABEL_FONT_SIZE);
+  dst.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_FAN_Y + dy);
+  dst.setTextColor(COLOR_LINE);
+  sprintf(buffer, "Fan: %d%% (%dRPM)", frame.fanSpeed, frame.fanRPM);
+  dst.print(buffer);
+
+  dst.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_PSU_Y + dy);
+  sprintf(buffer, "PSU: %.1fV", frame.psuVoltage);
+  dst.print(buffer);
+
+  dst.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_FLUIDNC_Y + dy);
+  if (frame.connected) {
+    if (frame.machineState == MACHINE_RUN) dst.setTextColor(COLOR_GOOD);
+    else if (frame.machineState == MACHINE_ALARM) dst.setTextColor(COLOR_WARN);
+    else dst.setTextColor(COLOR_VALUE);
+    sprintf(buffer, "FluidNC: %s", frame.stateText);
   } else {
-    gfx.setTextColor(COLOR_WARN);
+    dst.setTextColor(COLOR_WARN);
     sprintf(buffer, "FluidNC: Disconnected");
   }
-  gfx.print(buffer);
+  dst.print(buffer);
 
   // Coordinates
-  gfx.setTextColor(COLOR_TEXT);
-  gfx.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_COORDS_WCS_Y);
+  dst.setTextColor(COLOR_TEXT);
+  dst.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_COORDS_WCS_Y + dy);
   if (cfg.coord_decimal_places == 3) {
-    sprintf(buffer, "WCS: X:%.3f Y:%.3f Z:%.3f", fluidnc.wposX, fluidnc.wposY, fluidnc.wposZ);
+    sprintf(buffer, "WCS: X:%.3f Y:%.3f Z:%.3f", frame.wpos[0], frame.wpos[1], frame.wpos[2]);
   } else {
-    sprintf(buffer, "WCS: X:%.2f Y:%.2f Z:%.2f", fluidnc.wposX, fluidnc.wposY, fluidnc.wposZ);
+    sprintf(buffer, "WCS: X:%.2f Y:%.2f Z:%.2f", frame.wpos[0], frame.wpos[1], frame.wpos[2]);
   }
-  gfx.print(buffer);
+  dst.print(buffer);
 
-  gfx.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_COORDS_MCS_Y);
+  dst.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_COORDS_MCS_Y + dy);
   if (cfg.coord_decimal_places == 3) {
-    sprintf(buffer, "MCS: X:%.3f Y:%.3f Z:%.3f", fluidnc.posX, fluidnc.posY, fluidnc.posZ);
+    sprintf(buffer, "MCS: X:%.3f Y:%.3f Z:%.3f", frame.pos[0], frame.pos[1], frame.pos[2]);
   } else {
-    sprintf(buffer, "MCS: X:%.2f Y:%.2f Z:%.2f", fluidnc.posX, fluidnc.posY, fluidnc.posZ);
+    sprintf(buffer, "MCS: X:%.2f Y:%.2f Z:%.2f", frame.pos[0], frame.pos[1], frame.pos[2]);
   }
-  gfx.print(buffer);
-
-  // Right section - Temperature graph
-  gfx.setTextColor(COLOR_TEXT);
-  gfx.setCursor(MonitorLayout::GRAPH_LABEL_X, MonitorLayout::GRAPH_LABEL_Y);
-  gfx.print("TEMP HISTORY");
+  dst.print(buffer);
 
+  // Draw the temperature history graph
   if (cfg.show_temp_graph) {
-    char graphLabel[40];
-    if (cfg.graph_timespan_seconds >= 60) {
-      sprintf(graphLabel, "(%d min)", cfg.graph_timespan_seconds / 60);
-    } else {
-      sprintf(graphLabel, "(%d sec)", cfg.graph_timespan_seconds);
+    if (panel) {
+      drawTempGraph(MonitorLayout::GRAPH_X, MonitorLayout::GRAPH_Y, MonitorLayout::GRAPH_WIDTH, MonitorLayout::GRAPH_HEIGHT);
+    } else if (frame.history != nullptr) {
+      drawTempGraphCopy(dst, dy, *frame.history,
+                        MonitorLayout::GRAPH_X, MonitorLayout::GRAPH_Y, MonitorLayout::GRAPH_WIDTH, MonitorLayout::GRAPH_HEIGHT);
     }
-    gfx.setCursor(MonitorLayout::GRAPH_LABEL_X, MonitorLayout::GRAPH_TIMESPAN_Y);
-    gfx.setTextColor(COLOR_LINE);
-    gfx.print(graphLabel);
-
-    // Draw the temperature history graph
-    drawTempGraph(MonitorLayout::GRAPH_X, MonitorLayout::GRAPH_Y, MonitorLayout::GRAPH_WIDTH, MonitorLayout::GRAPH_HEIGHT);
   }
 }
 
-void updateMonitorMode() {
-  // LovyanGFX version - only update dynamic parts (clear area, then redraw)
-  char buffer[80];
+// One temperature row: the value comes from the digit atlas (changed
+// digits only), the peak is composited
+static void updateTempRow(int i) {
+  int rowY = MonitorLayout::TEMP_START_Y + i * MonitorLayout::TEMP_ROW_SPACING;
+  char value[DIGIT_FIELD_MAX + 1];
+  char peak[16];
+
+  // Convert to user's preferred unit
+  snprintf(value, sizeof(value), "%d%s", (int)convertTemp(sensors.temperatures[i]), cfg.use_fahrenheit ? "F" : "C");
+  sprintf(peak, "pk:%d%s", (int)convertTemp(sensors.peakTemps[i]), cfg.use_fahrenheit ? "F" : "C");
+  drawDigits(tempFields[i], value,
+             sensors.temperatures[i] > cfg.temp_threshold_high ? COLOR_WARN : COLOR_VALUE);
+
+  compositeText(MonitorLayout::PEAK_TEMP_X, rowY + MonitorLayout::PEAK_TEMP_Y_OFFSET,
+                MonitorLayout::PEAK_TEMP_WIDTH, MonitorLayout::PEAK_TEMP_HEIGHT, COLOR_BG,
+                0, 0, MonitorLayout::PEAK_TEMP_FONT_SIZE, COLOR_LINE, peak);
+}
 
-  // Update DateTime in header
+// One line of the status section, composited over COLOR_BG
+static void updateStatusLine(int y, uint16_t color, const char* text) {
+  compositeText(MonitorLayout::STATUS_LABEL_X, y,
+                MonitorLayout::STATUS_VALUE_WIDTH, MonitorLayout::STATUS_VALUE_HEIGHT, COLOR_BG,
+                0, 0, MonitorLayout::STATUS_LABEL_FONT_SIZE, color, text);
+}
+
+// ========== Monitor Fields ==========
+// Repainted by the render scheduler - each is rendered off-screen and
+// pushed with DMA (see region_compositor.h), so nothing is cleared on the panel
+
+static void drawMonitorClock() {
+  char buffer[40];
   if (network.rtcAvailable) {
     DateTime now = rtc.now();
     sprintf(buffer, "%s %02d  %02d:%02d:%02d",
@@ -185,94 +238,98 @@ void updateMonitorMode() {
   } else {
     sprintf(buffer, "No RTC");
   }
-  gfx.fillRect(MonitorLayout::DATETIME_X, 0, MonitorLayout::DATETIME_WIDTH, CommonLayout::HEADER_HEIGHT, COLOR_HEADER);
-  gfx.setTextSize(MonitorLayout::HEADER_FONT_SIZE);
-  gfx.setTextColor(COLOR_TEXT);
-  gfx.setCursor(MonitorLayout::DATETIME_X, MonitorLayout::DATETIME_Y);
-  gfx.print(buffer);
+  compositorBeginFrame();
+  compositeText(MonitorLayout::DATETIME_X, 0, MonitorLayout::DATETIME_WIDTH, CommonLayout::HEADER_HEIGHT,
+                COLOR_HEADER, 0, MonitorLayout::DATETIME_Y, MonitorLayout::HEADER_FONT_SIZE,
+                COLOR_TEXT, buffer);
+  compositorEndFrame();
+}
 
-  // Update temperature values and peaks
+static void drawMonitorTemps() {
+  compositorBeginFrame();
   for (int i = 0; i < 4; i++) {
-    int rowY = MonitorLayout::TEMP_START_Y + i * MonitorLayout::TEMP_ROW_SPACING;
-
-    // Clear the temperature display area for this driver
-    gfx.fillRect(MonitorLayout::TEMP_VALUE_X, rowY + MonitorLayout::TEMP_VALUE_Y_OFFSET,
-                 MonitorLayout::TEMP_VALUE_WIDTH, MonitorLayout::TEMP_VALUE_HEIGHT, COLOR_BG);
-
-    // Current temp (convert to user's preferred unit)
-    gfx.setTextSize(MonitorLayout::TEMP_VALUE_FONT_SIZE);
-    gfx.setTextColor(sensors.temperatures[i] > cfg.temp_threshold_high ? COLOR_WARN : COLOR_VALUE);
-    gfx.setCursor(MonitorLayout::TEMP_VALUE_X, rowY + MonitorLayout::TEMP_VALUE_Y_OFFSET);
-    sprintf(buffer, "%d%s", (int)convertTemp(sensors.temperatures[i]), cfg.use_fahrenheit ? "F" : "C");
-    gfx.print(buffer);
-
-    // Peak temp (convert to user's preferred unit)
-    gfx.setTextSize(MonitorLayout::PEAK_TEMP_FONT_SIZE);
-    gfx.setTextColor(COLOR_LINE);
-    gfx.setCursor(MonitorLayout::PEAK_TEMP_X, rowY + MonitorLayout::PEAK_TEMP_Y_OFFSET);
-    sprintf(buffer, "pk:%d%s", (int)convertTemp(sensors.peakTemps[i]), cfg.use_fahrenheit ? "F" : "C");
-    gfx.print(buffer);
+    updateTempRow(i);
   }
+  compositorEndFrame();
+}
 
-  // Update status section
-  gfx.setTextSize(MonitorLayout::STATUS_LABEL_FONT_SIZE);
-
-  // Fan
-  gfx.fillRect(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_FAN_Y,
-               MonitorLayout::STATUS_VALUE_WIDTH, MonitorLayout::STATUS_VALUE_HEIGHT, COLOR_BG);
-  gfx.setTextColor(COLOR_LINE);
-  gfx.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_FAN_Y);
+static void drawMonitorFanPsu() {
+  char buffer[40];
+  compositorBeginFrame();
   sprintf(buffer, "Fan: %d%% (%dRPM)", sensors.fanSpeed, sensors.fanRPM);
-  gfx.print(buffer);
+  updateStatusLine(MonitorLayout::STATUS_FAN_Y, COLOR_LINE, buffer);
 
-  // PSU
-  gfx.fillRect(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_PSU_Y,
-               MonitorLayout::STATUS_VALUE_WIDTH, MonitorLayout::STATUS_VALUE_HEIGHT, COLOR_BG);
-  gfx.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_PSU_Y);
-  gfx.setTextColor(COLOR_LINE);
   sprintf(buffer, "PSU: %.1fV", sensors.psuVoltage);
-  gfx.print(buffer);
-
-  // FluidNC Status
-  gfx.fillRect(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_FLUIDNC_Y,
-               MonitorLayout::STATUS_VALUE_WIDTH, MonitorLayout::STATUS_VALUE_HEIGHT, COLOR_BG);
-  gfx.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_FLUIDNC_Y);
-  if (fluidnc.connected) {
-    if (fluidnc.machineState == "RUN") gfx.setTextColor(COLOR_GOOD);
-    else if (fluidnc.machineState == "ALARM") gfx.setTextColor(COLOR_WARN);
-    else gfx.setTextColor(COLOR_VALUE);
-    sprintf(buffer, "FluidNC: %s", fluidnc.machineState.c_str());
+  updateStatusLine(MonitorLayout::STATUS_PSU_Y, COLOR_LINE, buffer);
+  compositorEndFrame();
+}
+
+static void drawMonitorFluidNC() {
+  char buffer[40];
+  uint16_t color;
+  if (fluidncView.connected) {
+    if (fluidncView.machineState == MACHINE_RUN) color = COLOR_GOOD;
+    else if (fluidncView.machineState == MACHINE_ALARM) color = COLOR_WARN;
+    else color = COLOR_VALUE;
+    sprintf(buffer, "FluidNC: %s", fluidncView.stateText);
   } else {
-    gfx.setTextColor(COLOR_WARN);
+    color = COLOR_WARN;
     sprintf(buffer, "FluidNC: Disconnected");
   }
-  gfx.print(buffer);
+  compositorBeginFrame();
+  updateStatusLine(MonitorLayout::STATUS_FLUIDNC_Y, color, buffer);
+  compositorEndFrame();
+}
 
-  // WCS Coordinates
-  gfx.fillRect(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_COORDS_WCS_Y,
-               MonitorLayout::STATUS_VALUE_WIDTH, MonitorLayout::STATUS_VALUE_HEIGHT, COLOR_BG);
-  gfx.setTextColor(COLOR_TEXT);
-  gfx.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_COORDS_WCS_Y);
+static void drawMonitorWcs() {
+  char buffer[80];
   if (cfg.coord_decimal_places == 3) {
-    sprintf(buffer, "WCS: X:%.3f Y:%.3f Z:%.3f", fluidnc.wposX, fluidnc.wposY, fluidnc.wposZ);
+    sprintf(buffer, "WCS: X:%.3f Y:%.3f Z:%.3f", fluidncView.wposX, fluidncView.wposY, fluidncView.wposZ);
   } else {
-    sprintf(buffer, "WCS: X:%.2f Y:%.2f Z:%.2f", fluidnc.wposX, fluidnc.wposY, fluidnc.wposZ);
+    sprintf(buffer, "WCS: X:%.2f Y:%.2f Z:%.2f", fluidncView.wposX, fluidncView.wposY, fluidncView.wposZ);
   }
-  gfx.print(buffer);
+  compositorBeginFrame();
+  updateStatusLine(MonitorLayout::STATUS_COORDS_WCS_Y, COLOR_TEXT, buffer);
+  compositorEndFrame();
+}
 
-  // MCS Coordinates
-  gfx.fillRect(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_COORDS_MCS_Y,
-               MonitorLayout::STATUS_VALUE_WIDTH, MonitorLayout::STATUS_VALUE_HEIGHT, COLOR_BG);
-  gfx.setCursor(MonitorLayout::STATUS_LABEL_X, MonitorLayout::STATUS_COORDS_MCS_Y);
+static void drawMonitorMcs() {
+  char buffer[80];
   if (cfg.coord_decimal_places == 3) {
-    sprintf(buffer, "MCS: X:%.3f Y:%.3f Z:%.3f", fluidnc.posX, fluidnc.posY, fluidnc.posZ);
+    sprintf(buffer, "MCS: X:%.3f Y:%.3f Z:%.3f", fluidncView.posX, fluidncView.posY, fluidncView.posZ);
   } else {
-    sprintf(buffer, "MCS: X:%.2f Y:%.2f Z:%.2f", fluidnc.posX, fluidnc.posY, fluidnc.posZ);
+    sprintf(buffer, "MCS: X:%.2f Y:%.2f Z:%.2f", fluidncView.posX, fluidncView.posY, fluidncView.posZ);
   }
-  gfx.print(buffer);
+  compositorBeginFrame();
+  updateStatusLine(MonitorLayout::STATUS_COORDS_MCS_Y, COLOR_TEXT, buffer);
+  compositorEndFrame();
+}
 
-  // Update temperature graph (if enabled)
+static void drawMonitorGraph() {
+  // New columns only (draws on the panel directly)
   if (cfg.show_temp_graph) {
-    drawTempGraph(MonitorLayout::GRAPH_X, MonitorLayout::GRAPH_Y, MonitorLayout::GRAPH_WIDTH, MonitorLayout::GRAPH_HEIGHT);
+    updateTempGraph(MonitorLayout::GRAPH_X, MonitorLayout::GRAPH_Y, MonitorLayout::GRAPH_WIDTH, MonitorLayout::GRAPH_HEIGHT);
   }
 }
+
+static uint32_t tempsVersion() { return sensors.tempVersion; }
+static uint32_t readingsVersion() { return sensors.readingVersion; }
+static uint32_t fluidncStatusVersion() { return fluidncVersionOf(fluidncView, FNC_CHG_STATE | FNC_CHG_CONNECTION); }
+static uint32_t wposVersion() { return fluidncVersionOf(fluidncView, FNC_CHG_WPOS); }
+static uint32_t mposVersion() { return fluidncVersionOf(fluidncView, FNC_CHG_MPOS); }
+static uint32_t graphVersion() { return tempGraphVersion(); }
+
+static RenderField monitorFields[] = {
+  // name       period  version                draw
+  {"clock",      1000,  nullptr,               drawMonitorClock,   0, 0},
+  {"temps",       250,  tempsVersion,          drawMonitorTemps,   0, 0},
+  {"fan_psu",     500,  readingsVersion,       drawMonitorFanPsu,  0, 0},
+  {"fluidnc",     100,  fluidncStatusVersion,  drawMonitorFluidNC, 0, 0},
+  {"wcs",          66,  wposVersion,           drawMonitorWcs,     0, 0},
+  {"mcs",          66,  mposVersion,           drawMonitorMcs,     0, 0},
+  {"graph",       500,  graphVersion,          drawMonitorGraph,   0, 0},
+};
+
+static void scheduleMonitorFields() {
+  setRenderFields(monitorFields, sizeof(monitorFields) / sizeof(monitorFields[0]));
+}
@@ -3,6 +3,8 @@
 #include "display.h"
 #include "config/config.h"
 #include "state/global_state.h"
+#include "network/link_stats.h"
+#include "render_scheduler.h"
 #include <WiFi.h>
 
 // External variables from main.cpp
@@ -11,6 +13,21 @@ extern bool webServerStarted;
 
 // ========== NETWORK MODE ==========
 
+static void scheduleNetworkFields();
+
+// FluidNC link quality row (RTT, jitter, message rate, lost polls)
+static void drawLinkStatsRow() {
+  char buffer[64];
+  formatLinkSummary(buffer, sizeof(buffer));
+
+  gfx.fillRect(NetworkLayout::STATUS_VALUE_X, NetworkLayout::STATUS_LINK_Y,
+               NetworkLayout::STATUS_LINK_WIDTH, NetworkLayout::STATUS_LINK_HEIGHT, COLOR_BG);
+  gfx.setTextSize(NetworkLayout::STATUS_ROW_FONT_SIZE);
+  gfx.setTextColor(COLOR_VALUE);
+  gfx.setCursor(NetworkLayout::STATUS_VALUE_X, NetworkLayout::STATUS_LINK_Y);
+  gfx.print(buffer);
+}
+
 void drawNetworkMode() {
   gfx.fillScreen(COLOR_BG);
 
@@ -104,7 +121,7 @@ void drawNetworkMode() {
       gfx.setCursor(NetworkLayout::STATUS_VALUE_X, NetworkLayout::STATUS_MDNS_Y);
       gfx.printf("http://%s.local", cfg.device_name);
 
-      if (fluidnc.connected) {
+      if (fluidncView.connected) {
         gfx.setTextColor(COLOR_TEXT);
         gfx.setCursor(NetworkLayout::STATUS_LABEL_X, NetworkLayout::STATUS_FLUIDNC_Y);
         gfx.print("FluidNC:");
@@ -120,6 +137,13 @@ void drawNetworkMode() {
         gfx.print("Disconnected");
       }
 
+      if (cfg.show_link_stats && fluidncView.connected) {
+        gfx.setTextColor(COLOR_TEXT);
+        gfx.setCursor(NetworkLayout::STATUS_LABEL_X, NetworkLayout::STATUS_LINK_Y);
+        gfx.print("Link:");
+        drawLinkStatsRow();
+      }
+
     } else {
       gfx.setCursor(NetworkLayout::NOT_CONNECTED_TITLE_X, NetworkLayout::NOT_CONNECTED_TITLE_Y);
       gfx.setTextColor(COLOR_WARN);
@@ -143,9 +167,35 @@ void drawNetworkMode() {
     gfx.setCursor(NetworkLayout::INSTRUCTIONS_LINE2_X, NetworkLayout::INSTRUCTIONS_LINE2_Y);
     gfx.print("configuration mode");
   }
+
+  scheduleNetworkFields();
 }
 
-void updateNetworkMode() {
-  // Update time in header if needed - but network info is mostly static
-  // Could add dynamic signal strength updates here
+// ========== Network Fields ==========
+
+static void drawNetworkLink() {
+  // Link statistics change every poll
+  if (cfg.show_link_stats && fluidncView.connected && !network.inAPMode &&
+      WiFi.status() == WL_CONNECTED) {
+    drawLinkStatsRow();
+  }
+}
+
+// WiFi/AP/FluidNC connection - any change redraws the whole status page
+static uint32_t connectionVersion() {
+  return ((uint32_t)WiFi.status() << 2) | (network.inAPMode ? 2 : 0) | (fluidncView.connected ? 1 : 0);
+}
+
+static void drawNetworkConnection() {
+  drawNetworkMode();
+}
+
+static RenderField networkFields[] = {
+  // name        period  version            draw
+  {"link",       1000,   nullptr,           drawNetworkLink,       0, 0},
+  {"connection", 1000,   connectionVersion, drawNetworkConnection, 0, 0},
+};
+
+static void scheduleNetworkFields() {
+  setRenderFields(networkFields, sizeof(networkFields) / sizeof(networkFields[0]));
 }
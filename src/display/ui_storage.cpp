@@ -4,11 +4,14 @@
 #include "state/global_state.h"
 #include "storage_manager.h"
 #include "logging/data_logger.h"
+#include "render_scheduler.h"
 #include <SD.h>
 #include <LittleFS.h>
 
 extern StorageManager storage;
 
+static void scheduleStorageFields();
+
 void drawStorageMode() {
     gfx.fillScreen(TFT_BLACK);
     gfx.setTextColor(TFT_WHITE, TFT_BLACK);
@@ -151,9 +154,13 @@ void drawStorageMode() {
     gfx.setTextColor(TFT_DARKGREY, TFT_BLACK);
     gfx.setCursor(10, 305);
     gfx.print("Tap screen to change modes");
+
+    scheduleStorageFields();
 }
 
-void updateStorageMode() {
+// ========== Storage Fields ==========
+
+static void drawStorageLogSize() {
     // Storage mode is relatively static, so we can update less frequently
     // Only update the log file size if logging is enabled
     if (!logger.isEnabled()) {
@@ -186,3 +193,12 @@ void updateStorageMode() {
         }
     }
 }
+
+static RenderField storageFields[] = {
+    // name        period  version  draw
+    {"log_size",   2000,   nullptr, drawStorageLogSize, 0, 0},
+};
+
+static void scheduleStorageFields() {
+    setRenderFields(storageFields, sizeof(storageFields) / sizeof(storageFields[0]));
+}
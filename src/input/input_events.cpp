@@ -0,0 +1,42 @@
+#include "input_events.h"
+#include "config/pins.h"
+#include "utils/spsc_queue.h"
+
+static SpscQueue<InputEvent, INPUT_QUEUE_SIZE> touchQueue;
+static SpscQueue<InputEvent, INPUT_QUEUE_SIZE> buttonQueue;
+
+// ========== Interrupt Handlers ==========
+
+static void IRAM_ATTR touchISR() {
+    InputEvent event = {INPUT_PEN_DOWN, millis()};
+    touchQueue.push(event);
+}
+
+static void IRAM_ATTR buttonISR() {
+    // Button pulls the pin low; record the level this edge left behind
+    InputEvent event = {digitalRead(BTN_MODE) == LOW ? INPUT_BUTTON_DOWN : INPUT_BUTTON_UP,
+                        millis()};
+    buttonQueue.push(event);
+}
+
+// ========== Setup / Consumers ==========
+
+void initInputEvents() {
+    pinMode(BTN_MODE, INPUT_PULLUP);
+    pinMode(TOUCH_IRQ, INPUT);          // Input-only pin, pulled up on the board
+
+    attachInterrupt(digitalPinToInterrupt(TOUCH_IRQ), touchISR, FALLING);
+    attachInterrupt(digitalPinToInterrupt(BTN_MODE), buttonISR, CHANGE);
+}
+
+bool nextTouchEvent(InputEvent& event) {
+    return touchQueue.pop(event);
+}
+
+bool nextButtonEvent(InputEvent& event) {
+    return buttonQueue.pop(event);
+}
+
+uint32_t inputEventsDropped() {
+    return touchQueue.dropped() + buttonQueue.dropped();
+}
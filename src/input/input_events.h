@@ -0,0 +1,40 @@
+#ifndef INPUT_EVENTS_H
+#define INPUT_EVENTS_H
+
+#include <Arduino.h>
+
+// ========== Input Events ==========
+// The XPT2046 pen-down line (TOUCH_IRQ) and the mode button (BTN_MODE) raise
+// GPIO interrupts that queue timestamped edges, so loop() no longer polls
+// the button or talks to the touch controller over the display's shared
+// SPI bus while nothing is touching the screen.
+//
+// Each source has its own queue: one ISR produces, one handler consumes.
+// Edges are hints - consumers confirm them (debounce, pin level, a touch
+// read) because GPIO36 can report spurious edges while the ADC or WiFi is
+// active (ESP32 errata 3.11).
+
+#define INPUT_QUEUE_SIZE 16             // Per source; holds 15 events
+#define BUTTON_DEBOUNCE_MS 30           // Button level must settle this long
+
+enum InputEventType : uint8_t {
+    INPUT_PEN_DOWN = 0,
+    INPUT_BUTTON_DOWN,
+    INPUT_BUTTON_UP
+};
+
+struct InputEvent {
+    InputEventType type;
+    unsigned long time;                 // millis() in the ISR
+};
+
+// Configure the pins and attach both interrupts - call once from setup()
+void initInputEvents();
+
+// Consumer side (loop only)
+bool nextTouchEvent(InputEvent& event);
+bool nextButtonEvent(InputEvent& event);
+
+uint32_t inputEventsDropped();          // Queue overflows, both sources
+
+#endif // INPUT_EVENTS_H
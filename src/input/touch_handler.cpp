@@ -1,6 +1,8 @@
 #include "touch_handler.h"
+#include "input_events.h"
 #include "display/display.h"
 #include "display/ui_modes.h"
+#include "display/render_profiler.h"
 #include "state/global_state.h"
 
 // External variables from main.cpp
@@ -10,20 +12,45 @@ extern void enterSetupMode();  // Function to enter WiFi AP mode
 static unsigned long lastTouchTime = 0;
 static unsigned long headerHoldStartTime = 0;
 static bool isHoldingHeader = false;
+static bool middleTouched = false;              // Middle zone held on the last poll
+static unsigned long lastMiddleTapTime = 0;
+static bool penDown = false;                    // Pen-down seen, not yet lifted
+static unsigned long penDownTime = 0;           // When it went down (ISR timestamp)
+
+// Only read the controller (SPI, shared with the display) while the pen is
+// down; the pen-down interrupt says when that starts
+static bool readTouch(uint16_t* x, uint16_t* y) {
+    InputEvent event;
+    while (nextTouchEvent(event)) {
+        if (!penDown) {
+            penDown = true;
+            penDownTime = event.time;
+        }
+    }
+    if (!penDown) return false;
+
+    if (gfx.getTouch(x, y)) return true;
+
+    // No reading - lifted unless PENIRQ is still held low (mid-conversion)
+    if (digitalRead(TOUCH_IRQ) == HIGH) {
+        penDown = false;
+    }
+    return false;
+}
 
 void handleTouchInput() {
     uint16_t x, y;
     unsigned long now = millis();
 
     // Check if screen is touched
-    if (gfx.getTouch(&x, &y)) {
+    if (readTouch(&x, &y)) {
         // Detect touch zones based on Y coordinate
         if (y < TOUCH_ZONE_HEADER_Y_MAX) {
             // Header zone - require 5 second hold
             if (!isHoldingHeader) {
                 // Start of hold
                 isHoldingHeader = true;
-                headerHoldStartTime = now;
+                headerHoldStartTime = penDownTime;
                 Serial.println("[TOUCH] Header hold started - hold for 5s to enter WiFi setup");
             } else {
                 // Continue holding - check duration and update progress
@@ -63,8 +90,22 @@ void handleTouchInput() {
                 Serial.println("[TOUCH] Header hold cancelled - moved to middle zone");
                 drawScreen();  // Clear progress bar
             }
+
+            // Double-tap toggles the performance overlay
+            if (!middleTouched) {
+                if (penDownTime - lastMiddleTapTime <= TOUCH_DOUBLE_TAP_MS) {
+                    Serial.println("[TOUCH] Middle zone double-tap - toggling perf overlay");
+                    togglePerfOverlay();
+                    lastMiddleTapTime = 0;
+                } else {
+                    lastMiddleTapTime = penDownTime;
+                }
+            }
         }
+        middleTouched = (y >= TOUCH_ZONE_HEADER_Y_MAX && y <= TOUCH_ZONE_FOOTER_Y_MIN);
     } else {
+        middleTouched = false;
+
         // No touch detected - cancel header hold if active
         if (isHoldingHeader) {
             isHoldingHeader = false;
@@ -75,8 +116,8 @@ void handleTouchInput() {
 }
 
 void cycleModeForward() {
-    // Cycle through 5 display modes: Monitor -> Alignment -> Graph -> Network -> Storage -> Monitor
-    currentMode = (DisplayMode)((currentMode + 1) % 5);
+    // Cycle through the display modes: Monitor -> Alignment -> Graph -> Network -> Storage -> DRO -> Monitor
+    currentMode = nextDisplayMode(currentMode);
 }
 
 void drawProgressBar(int progress) {
@@ -8,6 +8,7 @@
 #define TOUCH_ZONE_FOOTER_Y_MIN 280     // Tap footer = cycle screens
 #define TOUCH_DEBOUNCE_MS 300           // 300ms debounce for footer tap
 #define TOUCH_HOLD_DURATION_MS 5000     // 5 seconds hold required for WiFi setup
+#define TOUCH_DOUBLE_TAP_MS 400         // Middle zone double-tap = performance overlay
 
 // Touch handler functions
 void handleTouchInput();
@@ -13,7 +13,10 @@ DataLogger::DataLogger()
     , _logInterval(DEFAULT_INTERVAL)
     , _lastLogTime(0)
     , _currentLogFile("")
+    , _fluidncColumnsVersion(0)
+    , _fluidncColumnsValid(false)
 {
+    _fluidncColumns[0] = '\0';
 }
 
 void DataLogger::begin() {
@@ -143,7 +146,7 @@ void DataLogger::writeLogEntry() {
     // Write data row
     char logLine[256];
     snprintf(logLine, sizeof(logLine),
-        "%s,%.1f,%.1f,%.1f,%.1f,%.2f,%d,%d,%s,%.3f,%.3f,%.3f",
+        "%s,%.1f,%.1f,%.1f,%.1f,%.2f,%d,%d,%s",
         timestamp,  // RTC timestamp or uptime
         sensors.temperatures[0],
         sensors.temperatures[1],
@@ -152,10 +155,7 @@ void DataLogger::writeLogEntry() {
         sensors.psuVoltage,
         sensors.fanRPM,
         sensors.fanSpeed,
-        fluidnc.machineState.c_str(),
-        fluidnc.posX,
-        fluidnc.posY,
-        fluidnc.posZ
+        fluidncColumns()
     );
 
     size_t written = logFile.println(logLine);
@@ -170,6 +170,24 @@ void DataLogger::writeLogEntry() {
     }
 }
 
+const char* DataLogger::fluidncColumns() {
+    // Machine state and position rarely change between log entries on an
+    // idle machine - reuse the last formatted columns until they do
+    if (_fluidncColumnsValid &&
+        (fluidncChangesSince(fluidncView, _fluidncColumnsVersion) & (FNC_CHG_STATE | FNC_CHG_MPOS)) == 0) {
+        return _fluidncColumns;
+    }
+
+    snprintf(_fluidncColumns, sizeof(_fluidncColumns), "%s,%.3f,%.3f,%.3f",
+             fluidncView.stateText,
+             fluidncView.posX,
+             fluidncView.posY,
+             fluidncView.posZ);
+    _fluidncColumnsVersion = fluidncView.stateVersion;
+    _fluidncColumnsValid = true;
+    return _fluidncColumns;
+}
+
 void DataLogger::rotateLogFile() {
     // Clear current filename to force new one on next write
     _currentLogFile = "";
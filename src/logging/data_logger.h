@@ -24,12 +24,18 @@ private:
     void writeLogEntry();
     void rotateLogFile();
     void ensureLogDirectory();
+    const char* fluidncColumns();
 
     bool _enabled;
     unsigned long _logInterval;
     unsigned long _lastLogTime;
     String _currentLogFile;
 
+    // FluidNC CSV columns, re-formatted only when the state/MPos groups change
+    char _fluidncColumns[64];
+    uint32_t _fluidncColumnsVersion;
+    bool _fluidncColumnsValid;
+
     static constexpr unsigned long DEFAULT_INTERVAL = 10000;  // 10 seconds
     static constexpr size_t MAX_LOG_SIZE = 10 * 1024 * 1024;   // 10 MB
     static constexpr const char* LOG_DIR = "/logs";
@@ -17,11 +17,14 @@
 #include "config/config.h"
 #include "display/display.h"
 #include "display/ui_modes.h"
+#include "display/region_compositor.h"
+#include "display/digit_atlas.h"
 #include "sensors/sensors.h"
 #include "network/network.h"
 #include "utils/utils.h"
 #include "web/web_utils.h"
 #include "input/touch_handler.h"
+#include "input/input_events.h"
 #include "logging/data_logger.h"
 #include <Wire.h>
 #include <RTClib.h>
@@ -62,6 +65,8 @@ void setup() {
   gfx.setRotation(1);  // 90° rotation for landscape mode (480x320)
   gfx.setBrightness(255);
   Serial.println("Display initialized OK");
+  initCompositor();
+  initDigitAtlas();
   gfx.fillScreen(COLOR_BG);
   showSplashScreen();
 
@@ -84,7 +89,7 @@ void setup() {
     network.rtcAvailable = true;
   }
 
-  pinMode(BTN_MODE, INPUT_PULLUP);
+  initInputEvents();  // Mode button + touch pen-down interrupts
 
   // Configure ADC & PWM
   analogSetWidth(12);
@@ -193,6 +198,13 @@ void setup() {
       Serial.println("Device running standalone (temp/PSU/fan monitoring)");
       Serial.println("Hold button for 5+ seconds to enter WiFi setup mode");
 
+      // A wired FluidNC link still works without WiFi
+      if (cfg.fluidnc_auto_discover && cfg.fluidnc_transport == TRANSPORT_UART) {
+        Serial.println("[FluidNC] UART link enabled - connecting...");
+        connectFluidNC();
+        fluidnc.connectionAttempted = true;
+      }
+
       yield();
     }
   }
@@ -213,6 +225,9 @@ void setup() {
   logger.begin();
   Serial.println("Data logger initialized (disabled by default)");
 
+  // Web server + FluidNC client run on core 0 from here on
+  startNetworkTask();
+
   // Mark boot complete time for deferred FluidNC connection
   timing.bootCompleteTime = millis();
   Serial.println("Setup complete - entering main loop");
@@ -223,9 +238,10 @@ void loop() {
   // NOTE: FluidNC connection is now only initiated via web interface
   // Device runs standalone by default for temperature/PSU monitoring
 
-  // Handle web server requests
-  server.handleClient();
-  yield();
+  // Web server and WebSocket run in the network task (core 0) - just pick up
+  // the latest FluidNC snapshot for this iteration
+  refreshFluidNCView();
+
   handleButton();
   handleTouchInput();  // Handle touchscreen input
 
@@ -233,15 +249,30 @@ void loop() {
   sampleSensorsNonBlocking();
 
   // Process complete ADC readings when ready
+  bool sensorsUpdated = false;
   if (sensors.adcReady) {
     processAdcReadings();
     controlFan();
     sensors.adcReady = false;
+    sensorsUpdated = true;
   }
 
   if (millis() - timing.lastTachRead >= 1000) {
     calculateRPM();
     timing.lastTachRead = millis();
+    sensorsUpdated = true;
+  }
+
+  // Publish for the web handlers on core 0
+  if (sensorsUpdated) {
+    sensors.readingVersion++;
+    publishSensorState();
+  }
+
+  // Graph timespan changed via the web interface
+  if (history.resizePending) {
+    allocateHistoryBuffer();
+    history.resizePending = false;
   }
 
   if (millis() - timing.lastHistoryUpdate >= (cfg.graph_update_interval * 1000)) {
@@ -249,14 +280,9 @@ void loop() {
     timing.lastHistoryUpdate = millis();
   }
 
-  // Handle WebSocket connection and status polling
-  handleWebSocketLoop();
-
 
-  if (millis() - timing.lastDisplayUpdate >= 1000) {
-    updateDisplay();
-    timing.lastDisplayUpdate = millis();
-  }
+  // Repaint whichever screen fields are due (see render_scheduler.h)
+  updateDisplay();
 
   // Update data logger (if enabled)
   logger.update();
@@ -0,0 +1,46 @@
+#ifndef FLUIDNC_TRANSPORT_H
+#define FLUIDNC_TRANSPORT_H
+
+#include <Arduino.h>
+
+// ========== FluidNC Transport Interface ==========
+// network.cpp owns the link state machine (resolve, probe, backoff,
+// verification), the poll scheduler and the status parser. A transport only
+// moves bytes and reports back through the callbacks below, so the parser
+// sees the same input whichever path is selected (cfg.fluidnc_transport).
+
+class FluidNCTransport {
+public:
+    virtual ~FluidNCTransport() {}
+
+    virtual const char* name() const = 0;      // "websocket", "tcp", "uart"
+    virtual uint16_t port() const = 0;         // From cfg (0 = not IP based)
+
+    // False for wired links - no mDNS, and no dependence on WiFi
+    virtual bool needsNetwork() const { return true; }
+
+    // True if begin() blocks against an unreachable host, so network.cpp
+    // must TCP-probe the port first
+    virtual bool needsProbe() const = 0;
+
+    // Start connecting; progress is made in loop()
+    virtual void begin(const char* host) = 0;
+
+    // Close the connection. Reports fluidncTransportDisconnected() if it was up.
+    virtual void end() = 0;
+
+    // Non-blocking service - call every network task iteration while active
+    virtual void loop() = 0;
+
+    // Send a command or realtime character ("?", "$Report/Interval=200\n")
+    virtual bool send(const char* text) = 0;
+};
+
+// ========== Transport Callbacks (implemented in network.cpp) ==========
+void fluidncTransportConnected();
+void fluidncTransportDisconnected();
+
+// One status report or response line; not null-terminated
+void fluidncTransportMessage(const char* data, size_t length);
+
+#endif // FLUIDNC_TRANSPORT_H
@@ -0,0 +1,40 @@
+#include "line_assembler.h"
+
+void LineAssembler::commit(size_t n, LineHandler handler) {
+    _used += n;
+
+    size_t lineStart = 0;
+    for (size_t i = _scanned; i < _used; i++) {
+        if (_buffer[i] != '\n') continue;
+
+        size_t end = i;
+        if (end > lineStart && _buffer[end - 1] == '\r') end--;
+        if (_discarding) {
+            _discarding = false;    // Tail of an oversized line - drop it
+        } else if (end > lineStart) {
+            handler(_buffer + lineStart, end - lineStart);
+        }
+        lineStart = i + 1;
+    }
+
+    // Keep only the unfinished line
+    if (lineStart > 0) {
+        _used -= lineStart;
+        memmove(_buffer, _buffer + lineStart, _used);
+    }
+    _scanned = _used;
+
+    // Full with no newline - the line can never complete
+    if (_used == LINE_ASSEMBLER_SIZE) {
+        _overflows++;
+        _discarding = true;
+        _used = 0;
+        _scanned = 0;
+    }
+}
+
+void LineAssembler::reset() {
+    _used = 0;
+    _scanned = 0;
+    _discarding = false;
+}
@@ -0,0 +1,42 @@
+#ifndef LINE_ASSEMBLER_H
+#define LINE_ASSEMBLER_H
+
+#include <Arduino.h>
+
+// ========== Line Reassembly for Stream Transports ==========
+// A TCP or UART byte stream splits status reports at arbitrary points. The
+// transport reads straight into writePtr(), and commit() hands every
+// complete line to the handler as a pointer into the buffer - no per-line
+// copy, no String. Only an unfinished tail is moved back to the start.
+//
+// Lines are passed without their "\r\n" and are not null-terminated (the
+// status parser is bounded by length). Blank lines are skipped. A line that
+// does not fit in the buffer is dropped and counted in overflows().
+
+#define LINE_ASSEMBLER_SIZE 512     // FluidNC status lines are < 256 bytes
+
+typedef void (*LineHandler)(const char* line, size_t length);
+
+class LineAssembler {
+public:
+    LineAssembler() : _used(0), _scanned(0), _discarding(false), _overflows(0) {}
+
+    // Free space to receive into
+    char* writePtr() { return _buffer + _used; }
+    size_t writeSpace() const { return LINE_ASSEMBLER_SIZE - _used; }
+
+    // n bytes were written at writePtr() - dispatch the complete lines
+    void commit(size_t n, LineHandler handler);
+
+    void reset();
+    uint32_t overflows() const { return _overflows; }
+
+private:
+    char _buffer[LINE_ASSEMBLER_SIZE];
+    size_t _used;           // Bytes in _buffer
+    size_t _scanned;        // Bytes already searched for '\n'
+    bool _discarding;       // Skipping the rest of an oversized line
+    uint32_t _overflows;
+};
+
+#endif // LINE_ASSEMBLER_H
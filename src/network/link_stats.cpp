@@ -0,0 +1,141 @@
+#include "link_stats.h"
+
+#define POLL_ANSWER_TIMEOUT 2000000UL   // us before an outstanding poll counts as lost
+
+const uint16_t LINK_HIST_LIMITS[LINK_HIST_BUCKETS - 1] = {
+    10, 20, 50, 100, 200, 500, 1000
+};
+
+LinkStats linkStats;
+Seqlock<LinkStats> linkStatsSnapshot;
+static bool linkStatsDirty = false;
+
+static bool pollOutstanding = false;
+static unsigned long pollSentUs = 0;
+static bool haveRtt = false;
+
+static unsigned long windowStart = 0;
+static uint32_t windowMessages = 0;
+static uint32_t windowBytes = 0;
+
+static uint8_t histBucket(uint32_t us) {
+    uint32_t ms = us / 1000;
+    uint8_t i = 0;
+    while (i < LINK_HIST_BUCKETS - 1 && ms >= LINK_HIST_LIMITS[i]) i++;
+    return i;
+}
+
+// ========== Hooks ==========
+
+void linkStatsPollSent() {
+    unsigned long now = micros();
+    if (pollOutstanding) {
+        linkStats.pollsUnanswered++;  // Previous poll never got its report
+    }
+    pollOutstanding = true;
+    pollSentUs = now;
+    linkStats.pollsSent++;
+    linkStatsDirty = true;
+}
+
+void linkStatsMessage(size_t bytes) {
+    linkStats.messages++;
+    linkStats.bytes += bytes;
+    windowMessages++;
+    windowBytes += bytes;
+    linkStatsDirty = true;
+    updateLinkRates();
+}
+
+void linkStatsReport(uint32_t parseUs) {
+    unsigned long now = micros();
+    linkStatsDirty = true;
+
+    // Parse time
+    linkStats.reportsParsed++;
+    linkStats.parseLastUs = parseUs;
+    if (parseUs > linkStats.parseMaxUs) linkStats.parseMaxUs = parseUs;
+    linkStats.parseAvgUs = (linkStats.reportsParsed == 1) ? parseUs
+                         : (linkStats.parseAvgUs * 7 + parseUs) / 8;
+
+    if (!pollOutstanding) {
+        linkStats.unsolicitedReports++;
+        return;
+    }
+    pollOutstanding = false;
+
+    uint32_t rtt = now - pollSentUs;
+    if (rtt >= POLL_ANSWER_TIMEOUT) {
+        linkStats.pollsUnanswered++;  // Too late to be the answer to this poll
+        return;
+    }
+    linkStats.pollsAnswered++;
+
+    if (haveRtt) {
+        uint32_t delta = (rtt > linkStats.rttLastUs) ? rtt - linkStats.rttLastUs
+                                                     : linkStats.rttLastUs - rtt;
+        linkStats.jitterUs = (linkStats.jitterUs * 15 + delta) / 16;
+        linkStats.jitterHist[histBucket(delta)]++;
+        linkStats.rttAvgUs = (linkStats.rttAvgUs * 7 + rtt) / 8;
+        if (rtt < linkStats.rttMinUs) linkStats.rttMinUs = rtt;
+        if (rtt > linkStats.rttMaxUs) linkStats.rttMaxUs = rtt;
+    } else {
+        linkStats.rttAvgUs = rtt;
+        linkStats.rttMinUs = rtt;
+        linkStats.rttMaxUs = rtt;
+        haveRtt = true;
+    }
+    linkStats.rttLastUs = rtt;
+    linkStats.rttHist[histBucket(rtt)]++;
+}
+
+void updateLinkRates() {
+    unsigned long now = millis();
+    unsigned long elapsed = now - windowStart;
+    if (elapsed < 1000) return;
+
+    // A window much longer than 1 s means nothing arrived for a while
+    linkStats.messagesPerSec = windowMessages * 1000.0f / elapsed;
+    linkStats.bytesPerSec = windowBytes * 1000.0f / elapsed;
+    windowMessages = 0;
+    windowBytes = 0;
+    windowStart = now;
+    linkStatsDirty = true;
+
+    // Poll with no answer for too long - count it now rather than on the next poll
+    if (pollOutstanding && micros() - pollSentUs >= POLL_ANSWER_TIMEOUT) {
+        linkStats.pollsUnanswered++;
+        pollOutstanding = false;
+    }
+}
+
+void resetLinkStats() {
+    memset(&linkStats, 0, sizeof(linkStats));
+    pollOutstanding = false;
+    haveRtt = false;
+    windowStart = millis();
+    windowMessages = 0;
+    windowBytes = 0;
+    linkStatsDirty = true;
+}
+
+void publishLinkStats() {
+    if (!linkStatsDirty) return;
+    linkStatsSnapshot.write(linkStats);
+    linkStatsDirty = false;
+}
+
+void formatLinkSummary(char* buffer, size_t size) {
+    LinkStats stats;
+    linkStatsSnapshot.read(stats);
+
+    if (stats.pollsAnswered == 0) {  // No RTT measured yet
+        snprintf(buffer, size, "No replies yet  %.1f msg/s", stats.messagesPerSec);
+        return;
+    }
+    snprintf(buffer, size, "RTT %lums (j %lums)  %.1f msg/s  %lu lost",
+             (unsigned long)(stats.rttAvgUs / 1000),
+             (unsigned long)(stats.jitterUs / 1000),
+             stats.messagesPerSec,
+             (unsigned long)stats.pollsUnanswered);
+}
@@ -0,0 +1,64 @@
+#ifndef LINK_STATS_H
+#define LINK_STATS_H
+
+#include <Arduino.h>
+#include "../utils/seqlock.h"
+
+// ========== FluidNC Link Statistics ==========
+// Every '?' poll is timestamped and matched to the next status report, so
+// stale coordinates can be pinned on WiFi (RTT), FluidNC (unanswered polls)
+// or our own loop (parse time, message rate).
+
+#define LINK_HIST_BUCKETS 8
+
+// Upper bounds (ms) of the RTT/jitter histogram buckets; the last is open
+extern const uint16_t LINK_HIST_LIMITS[LINK_HIST_BUCKETS - 1];
+
+struct LinkStats {
+    // Polls
+    uint32_t pollsSent;
+    uint32_t pollsAnswered;
+    uint32_t pollsUnanswered;       // Superseded by the next poll or timed out
+    uint32_t unsolicitedReports;    // Reports with no poll outstanding (auto-report)
+
+    // Round trip (poll -> report)
+    uint32_t rttLastUs;
+    uint32_t rttMinUs;
+    uint32_t rttMaxUs;
+    uint32_t rttAvgUs;              // Exponential moving average
+    uint32_t jitterUs;              // Smoothed |RTT delta| (RFC 3550 style)
+    uint32_t rttHist[LINK_HIST_BUCKETS];
+    uint32_t jitterHist[LINK_HIST_BUCKETS];
+
+    // Traffic
+    uint32_t messages;              // WebSocket TEXT/BIN frames received
+    uint32_t bytes;
+    float messagesPerSec;           // Over the last completed 1 s window
+    float bytesPerSec;
+
+    // Parser
+    uint32_t reportsParsed;
+    uint32_t parseLastUs;
+    uint32_t parseMaxUs;
+    uint32_t parseAvgUs;
+};
+extern LinkStats linkStats;               // Core 0 (network task, web handlers)
+extern Seqlock<LinkStats> linkStatsSnapshot;  // Copy for the display core
+
+// Hooks (network / poll scheduler)
+void linkStatsPollSent();
+void linkStatsMessage(size_t bytes);
+void linkStatsReport(uint32_t parseUs);
+
+// Roll the per-second rate window (cheap, call often from the network task)
+void updateLinkRates();
+
+void resetLinkStats();
+
+// Copy linkStats into linkStatsSnapshot if it changed (core 0, network task)
+void publishLinkStats();
+
+// One-line summary for the Network screen, from the snapshot (core 1) ("RTT 42ms j3 5.0msg/s 0 lost")
+void formatLinkSummary(char* buffer, size_t size);
+
+#endif // LINK_STATS_H
@@ -1,10 +1,20 @@
 #include "network.h"
+#include "status_parser.h"
+#include "poll_scheduler.h"
+#include "link_stats.h"
+#include "websocket_transport.h"
+#include "tcp_transport.h"
+#include "uart_transport.h"
 #include "../state/global_state.h"
 #include "config/config.h"
 #include <WiFi.h>
 #include <WiFiManager.h>
 #include <WebSocketsClient.h>
 #include <ESPmDNS.h>
+#include <mdns.h>
+#include <lwip/sockets.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 
 // ========== WiFiManager Setup ==========
 
@@ -19,301 +29,440 @@ void setupWiFiManager() {
 }
 
 // ========== FluidNC Connection ==========
+// Non-blocking connection state machine, advanced a step per loop():
+//   RESOLVE  - async mDNS query for a "fluidnc" host (discovery only)
+//   PROBE    - non-blocking TCP connect to the transport's port (skipped
+//              by transports whose own connect is non-blocking)
+//   UPGRADE  - transport connect/handshake (transport loop runs from here on)
+//   VERIFIED - first status report received; address cached in NVS
+// Any failure drops to BACKOFF and retries after 1s, 2s, 4s ... 30s, so a
+// powered-off controller never stalls touch, fans or the web server.
+
+enum LinkState : uint8_t {
+    LINK_IDLE = 0,
+    LINK_RESOLVE,
+    LINK_PROBE,
+    LINK_UPGRADE,
+    LINK_VERIFIED,
+    LINK_BACKOFF
+};
+
+static const char* const LINK_STATE_NAMES[] = {
+    "idle", "resolve", "probe", "upgrade", "verified", "backoff"
+};
+
+#define LINK_RESOLVE_TIMEOUT   1500    // ms for the mDNS query
+#define LINK_PROBE_TIMEOUT     2000    // ms for the TCP probe
+#define LINK_UPGRADE_TIMEOUT   6000    // ms for handshake + first report
+#define LINK_BACKOFF_MIN       1000    // ms after the first failure
+#define LINK_BACKOFF_MAX       30000   // ms cap
+
+static LinkState linkState = LINK_IDLE;
+static unsigned long linkStateTime = 0;     // millis() when the state was entered
+static uint8_t linkFailures = 0;
+static bool linkDiscover = false;           // Resolve via mDNS before probing
+static char linkHost[16] = "";              // Address being tried
+static char lastGoodHost[16] = "";          // Last verified address (NVS "fnc_lastip")
+static bool lastGoodLoaded = false;
+static int probeSocket = -1;
+static mdns_search_once_t* mdnsSearch = nullptr;
+static FluidNCTransport* transport = &webSocketTransport;
+
+static FluidNCTransport* selectTransport() {
+    switch (cfg.fluidnc_transport) {
+        case TRANSPORT_TCP:
+            return &tcpTransport;
+        case TRANSPORT_UART:
+            return &uartTransport;
+        default:
+            return &webSocketTransport;
+    }
+}
 
-void connectFluidNC() {
-    Serial.printf("[FluidNC] Attempting to connect to ws://%s:%d/ws\n",
-                  cfg.fluidnc_ip, cfg.fluidnc_port);
-
-    // Pre-connection: Send HTTP GET to populate ARP cache and verify host is reachable
-    // This solves the issue where FluidNC is running but network path isn't established
-    Serial.println("[FluidNC] Sending pre-connection HTTP request to populate ARP cache...");
-    WiFiClient client;
-    client.setTimeout(2000);  // 2 second timeout
-    if (client.connect(cfg.fluidnc_ip, 80)) {
-        Serial.println("[FluidNC] Host is reachable, ARP cache populated");
-        client.print("GET / HTTP/1.1\r\nHost: ");
-        client.print(cfg.fluidnc_ip);
-        client.print("\r\nConnection: close\r\n\r\n");
-        client.stop();
-        delay(100);  // Brief delay to let network settle
-    } else {
-        Serial.println("[FluidNC] Warning: Host not reachable via HTTP, attempting WebSocket anyway...");
+static void setLinkState(LinkState state) {
+    linkState = state;
+    linkStateTime = millis();
+}
+
+static void closeProbe() {
+    if (probeSocket >= 0) {
+        close(probeSocket);
+        probeSocket = -1;
     }
+}
 
-    // Now connect WebSocket
-    webSocket.begin(cfg.fluidnc_ip, cfg.fluidnc_port, "/ws");
-    webSocket.onEvent(fluidNCWebSocketEvent);
-    webSocket.setReconnectInterval(5000);
-    Serial.println("[FluidNC] WebSocket initialized, waiting for connection...");
+static void cancelResolve() {
+    if (mdnsSearch != nullptr) {
+        mdns_query_async_delete(mdnsSearch);
+        mdnsSearch = nullptr;
+    }
 }
 
-void discoverFluidNC() {
-  Serial.println("Auto-discovering FluidNC...");
+static void loadLastGoodHost() {
+    if (lastGoodLoaded) return;
+    prefs.begin("fluiddash", true);
+    strlcpy(lastGoodHost, prefs.getString("fnc_lastip", "").c_str(), sizeof(lastGoodHost));
+    prefs.end();
+    lastGoodLoaded = true;
+}
 
-  // Feed watchdog before potentially long mDNS query
-  yield();
-  delay(10);  // Brief delay to let system settle
+static void saveLastGoodHost() {
+    if (strcmp(lastGoodHost, linkHost) == 0) return;  // Avoid NVS wear
+    strlcpy(lastGoodHost, linkHost, sizeof(lastGoodHost));
+    prefs.begin("fluiddash", false);
+    prefs.putString("fnc_lastip", lastGoodHost);
+    prefs.end();
+}
 
-  // Try mDNS discovery first
-  Serial.println("[mDNS] Querying for FluidNC services...");
-  int n = MDNS.queryService("http", "tcp");
+static void linkFailed(const char* reason) {
+    bool socketOpen = (linkState == LINK_UPGRADE || linkState == LINK_VERIFIED);
 
-  // Feed watchdog after mDNS query
-  yield();
+    if (linkFailures < 255) linkFailures++;
+    uint8_t shift = min(linkFailures - 1, 5);
+    unsigned long backoff = min((unsigned long)LINK_BACKOFF_MIN << shift, (unsigned long)LINK_BACKOFF_MAX);
+    Serial.printf("[FluidNC] %s (%s) - retrying in %lu ms\n", reason, linkHost, backoff);
 
-  Serial.printf("[mDNS] Found %d service(s)\n", n);
+    // Leave UPGRADE/VERIFIED before disconnecting so the resulting
+    // disconnect callback does not count as a second failure
+    setLinkState(LINK_BACKOFF);
+    linkStateTime += backoff;  // BACKOFF leaves once millis() passes this
 
-  for (int i = 0; i < n; i++) {
-    yield();  // Feed watchdog in loop
+    closeProbe();
+    cancelResolve();
+    if (socketOpen) {
+        transport->end();
+    }
+}
 
-    String hostname = MDNS.hostname(i);
-    Serial.printf("[mDNS] Service %d: %s\n", i, hostname.c_str());
+// Start an attempt: mDNS first when discovering without a cached address
+// (or after the cached one failed), otherwise straight to the probe
+static void startAttempt() {
+    if (!transport->needsNetwork()) {
+        setLinkState(LINK_PROBE);  // Nothing to resolve - straight to begin()
+        return;
+    }
 
-    if (hostname.indexOf("fluidnc") >= 0) {
-      IPAddress ip = MDNS.IP(i);
-      strlcpy(cfg.fluidnc_ip, ip.toString().c_str(), sizeof(cfg.fluidnc_ip));
-      Serial.printf("Found FluidNC at: %s\n", cfg.fluidnc_ip);
-      connectFluidNC();
-      return;
+    if (linkDiscover && (lastGoodHost[0] == '\0' || linkFailures > 0)) {
+        Serial.println("[mDNS] Querying for FluidNC services...");
+        mdnsSearch = mdns_query_async_new(nullptr, "_http", "_tcp", MDNS_TYPE_PTR,
+                                          LINK_RESOLVE_TIMEOUT, 8, nullptr);
+        if (mdnsSearch != nullptr) {
+            setLinkState(LINK_RESOLVE);
+            return;
+        }
     }
-  }
 
-  // Fallback to configured IP
-  Serial.println("No FluidNC found via mDNS, using configured IP");
-  connectFluidNC();
+    if (linkDiscover && lastGoodHost[0] != '\0') {
+        strlcpy(linkHost, lastGoodHost, sizeof(linkHost));
+    } else {
+        strlcpy(linkHost, cfg.fluidnc_ip, sizeof(linkHost));
+    }
+    setLinkState(LINK_PROBE);
 }
 
-void fluidNCWebSocketEvent(WStype_t type, uint8_t * payload, size_t length) {
-    switch(type) {
-        case WStype_DISCONNECTED:
-            Serial.println("[FluidNC] Disconnected!");
-            fluidnc.connected = false;
-            fluidnc.machineState = "OFFLINE";
+static void serviceResolve() {
+    mdns_result_t* results = nullptr;
+    uint8_t count = 0;
+    if (!mdns_query_async_get_results(mdnsSearch, 0, &results, &count)) {
+        return;  // Still querying
+    }
+
+    bool found = false;
+    for (mdns_result_t* r = results; r != nullptr && !found; r = r->next) {
+        if (r->hostname == nullptr || strstr(r->hostname, "fluidnc") == nullptr) continue;
+        for (mdns_ip_addr_t* a = r->addr; a != nullptr; a = a->next) {
+            if (a->addr.type != 0) continue;  // IPv4 only
+            IPAddress ip(a->addr.u_addr.ip4.addr);
+            strlcpy(linkHost, ip.toString().c_str(), sizeof(linkHost));
+            Serial.printf("[mDNS] Found FluidNC at: %s\n", linkHost);
+            found = true;
             break;
+        }
+    }
+    mdns_query_results_free(results);
+    cancelResolve();
+
+    if (!found) {
+        // Fall back to the last verified address, then the configured one
+        strlcpy(linkHost, lastGoodHost[0] ? lastGoodHost : cfg.fluidnc_ip, sizeof(linkHost));
+        Serial.printf("[mDNS] No FluidNC found, trying %s\n", linkHost);
+    }
+    setLinkState(LINK_PROBE);
+}
 
-        case WStype_CONNECTED:
-            Serial.printf("[FluidNC] Connected to: %s\n", payload);
-            fluidnc.connected = true;
-            fluidnc.machineState = "IDLE";
+// Returns true once the TCP probe has connected
+static bool serviceProbe() {
+    if (probeSocket < 0) {
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(transport->port());
+        if (inet_pton(AF_INET, linkHost, &addr.sin_addr) != 1) {
+            linkFailed("Invalid address");
+            return false;
+        }
 
-            // DON'T send ReportInterval - FluidNC doesn't support it
-            // We'll use manual polling with ? status requests
-            fluidnc.reportingSetupTime = millis();
-            break;
+        probeSocket = socket(AF_INET, SOCK_STREAM, 0);
+        if (probeSocket < 0) {
+            linkFailed("Socket unavailable");
+            return false;
+        }
+        fcntl(probeSocket, F_SETFL, fcntl(probeSocket, F_GETFL, 0) | O_NONBLOCK);
 
-        case WStype_TEXT:
-            {
-                char* msg = (char*)payload;
-                if (fluidnc.debugWebSocket) {
-                    Serial.printf("[FluidNC] RX TEXT (%d bytes): ", length);
-                    for(size_t i = 0; i < length; i++) {
-                        Serial.print(msg[i]);
-                    }
-                    Serial.println();
-                }
-
-                String msgStr = String(msg);
-                if (msgStr.startsWith("<")) {
-                    parseFluidNCStatus(msgStr);
-                } else if (msgStr.startsWith("ALARM:")) {
-                    fluidnc.machineState = "ALARM";
-                    parseFluidNCStatus(msgStr);
-                }
-            }
-            break;
+        if (connect(probeSocket, (struct sockaddr*)&addr, sizeof(addr)) == 0) {
+            closeProbe();
+            return true;
+        }
+        if (errno != EINPROGRESS) {
+            linkFailed("Host unreachable");
+            return false;
+        }
+    }
 
-        case WStype_BIN:
-            {
-                // FluidNC sends status as BINARY data
-                if (fluidnc.debugWebSocket) {
-                    Serial.printf("[FluidNC] RX BINARY (%d bytes): ", length);
-                }
-
-                // Convert binary payload to null-terminated string
-                char* msg = (char*)malloc(length + 1);
-                if (msg != nullptr) {
-                    memcpy(msg, payload, length);
-                    msg[length] = '\0';
-
-                    if (fluidnc.debugWebSocket) {
-                        Serial.println(msg);
-                    }
-
-                    // Parse the status message
-                    String msgStr = String(msg);
-                    parseFluidNCStatus(msgStr);
-
-                    free(msg);
-                } else {
-                    Serial.println("[FluidNC] ERROR: Failed to allocate memory");
-                }
-            }
+    // Poll for completion without blocking
+    fd_set writeSet;
+    FD_ZERO(&writeSet);
+    FD_SET(probeSocket, &writeSet);
+    struct timeval tv = {0, 0};
+    if (select(probeSocket + 1, nullptr, &writeSet, nullptr, &tv) > 0) {
+        int err = 0;
+        socklen_t len = sizeof(err);
+        getsockopt(probeSocket, SOL_SOCKET, SO_ERROR, &err, &len);
+        closeProbe();
+        if (err != 0) {
+            linkFailed("Connection refused");
+            return false;
+        }
+        return true;
+    }
+
+    if (millis() - linkStateTime >= LINK_PROBE_TIMEOUT) {
+        linkFailed("Probe timed out");
+    }
+    return false;
+}
+
+static void serviceFluidNCLink() {
+    switch (linkState) {
+        case LINK_IDLE:
+        case LINK_VERIFIED:
             break;
 
-        case WStype_ERROR:
-            Serial.println("[FluidNC] WebSocket Error!");
+        case LINK_BACKOFF:
+            if ((long)(millis() - linkStateTime) >= 0) {
+                startAttempt();
+            }
             break;
 
-        case WStype_PING:
-            // Ping/pong for keep-alive - normal, no logging needed
+        case LINK_RESOLVE:
+            serviceResolve();
             break;
 
-        case WStype_PONG:
+        case LINK_PROBE:
+            // Once the host answers on the port a blocking connect (the
+            // WebSocket library's) completes immediately
+            if (!transport->needsProbe() || serviceProbe()) {
+                // UPGRADE first - begin() may report connect/failure at once
+                setLinkState(LINK_UPGRADE);
+                transport->begin(linkHost);
+            }
             break;
 
-        default:
-            if (fluidnc.debugWebSocket) {
-                Serial.printf("[FluidNC] Event type: %d\n", type);
+        case LINK_UPGRADE:
+            if (millis() - linkStateTime >= LINK_UPGRADE_TIMEOUT) {
+                linkFailed("No status report after connecting");
             }
             break;
     }
 }
 
-void parseFluidNCStatus(String status) {
-    String oldState = fluidnc.machineState;
+// First status report on a new connection - the link is good
+static void verifyFluidNCLink() {
+    if (linkState != LINK_UPGRADE) return;
+    Serial.printf("[FluidNC] Link verified (%s)\n", linkHost);
+    setLinkState(LINK_VERIFIED);
+    linkFailures = 0;
+    saveLastGoodHost();
+}
 
-    // Parse state (between < and |)
-    int stateEnd = status.indexOf('|');
-    if (stateEnd > 0) {
-        String state = status.substring(1, stateEnd);
-        fluidnc.machineState = state;
-        fluidnc.machineState.toUpperCase();
+static void startFluidNCLink(bool discover) {
+    disconnectFluidNC();
+    transport = selectTransport();
+    loadLastGoodHost();
+    linkDiscover = discover;
+    linkFailures = 0;
+    startAttempt();
+}
 
-        // Job tracking
-        if (oldState != "RUN" && fluidnc.machineState == "RUN") {
-            fluidnc.jobStartTime = millis();
-            fluidnc.isJobRunning = true;
-        }
-        if (oldState == "RUN" && fluidnc.machineState != "RUN") {
-            fluidnc.isJobRunning = false;
-        }
-    }
+void connectFluidNC() {
+    Serial.printf("[FluidNC] Connecting to %s (%s)\n", cfg.fluidnc_ip, selectTransport()->name());
+    startFluidNCLink(false);
+}
 
-    // Parse MPos (Machine Position) - supports 3 or 4 axes
-    int mposIndex = status.indexOf("MPos:");
-    if (mposIndex >= 0) {
-        int endIndex = status.indexOf('|', mposIndex);
-        if (endIndex < 0) endIndex = status.indexOf('>', mposIndex);
-        String posStr = status.substring(mposIndex + 5, endIndex);
-
-        // Count commas to determine axis count
-        int commaCount = 0;
-        for (int i = 0; i < posStr.length(); i++) {
-            if (posStr.charAt(i) == ',') commaCount++;
-        }
+void discoverFluidNC() {
+    Serial.println("Auto-discovering FluidNC...");
+    startFluidNCLink(true);
+}
 
-        if (commaCount >= 3) {
-            // 4-axis machine
-            sscanf(posStr.c_str(), "%f,%f,%f,%f", &fluidnc.posX, &fluidnc.posY, &fluidnc.posZ, &fluidnc.posA);
-        } else {
-            // 3-axis machine
-            sscanf(posStr.c_str(), "%f,%f,%f", &fluidnc.posX, &fluidnc.posY, &fluidnc.posZ);
-            fluidnc.posA = 0;
-        }
-    }
+void disconnectFluidNC() {
+    bool socketOpen = (linkState == LINK_UPGRADE || linkState == LINK_VERIFIED);
+    setLinkState(LINK_IDLE);
 
-    // Parse WPos (Work Position) if present
-    int wposIndex = status.indexOf("WPos:");
-    if (wposIndex >= 0) {
-        int endIndex = status.indexOf('|', wposIndex);
-        if (endIndex < 0) endIndex = status.indexOf('>', wposIndex);
-        String posStr = status.substring(wposIndex + 5, endIndex);
+    closeProbe();
+    cancelResolve();
+    if (socketOpen) {
+        transport->end();
+    }
+}
 
-        int commaCount = 0;
-        for (int i = 0; i < posStr.length(); i++) {
-            if (posStr.charAt(i) == ',') commaCount++;
-        }
+const char* fluidncLinkStateName() {
+    return LINK_STATE_NAMES[linkState];
+}
 
-        if (commaCount >= 3) {
-            sscanf(posStr.c_str(), "%f,%f,%f,%f", &fluidnc.wposX, &fluidnc.wposY, &fluidnc.wposZ, &fluidnc.wposA);
-        } else {
-            sscanf(posStr.c_str(), "%f,%f,%f", &fluidnc.wposX, &fluidnc.wposY, &fluidnc.wposZ);
-            fluidnc.wposA = 0;
-        }
-    } else {
-        // No WPos - use MPos
-        fluidnc.wposX = fluidnc.posX;
-        fluidnc.wposY = fluidnc.posY;
-        fluidnc.wposZ = fluidnc.posZ;
-        fluidnc.wposA = fluidnc.posA;
+// Parse a status report frame and feed the poll/link bookkeeping
+static void handleStatusFrame(const char* data, size_t length) {
+    uint32_t parseStart = micros();
+    if (parseFluidNCStatus(data, length)) {
+        linkStatsReport(micros() - parseStart);
+        notePollReport();
+        verifyFluidNCLink();
     }
+}
 
-    // Parse WCO (Work Coordinate Offset) if present
-    int wcoIndex = status.indexOf("WCO:");
-    if (wcoIndex >= 0) {
-        int endIndex = status.indexOf('|', wcoIndex);
-        if (endIndex < 0) endIndex = status.indexOf('>', wcoIndex);
-        String wcoStr = status.substring(wcoIndex + 4, endIndex);
+// ========== Transport Callbacks ==========
 
-        int commaCount = 0;
-        for (int i = 0; i < wcoStr.length(); i++) {
-            if (wcoStr.charAt(i) == ',') commaCount++;
-        }
+void fluidncTransportConnected() {
+    fluidnc.connected = true;
+    fluidnc.machineState = MACHINE_IDLE;
+    fluidnc.machineSubstate = -1;
+    markFluidNCChanged(FNC_CHG_CONNECTION | FNC_CHG_STATE);
 
-        if (commaCount >= 3) {
-            sscanf(wcoStr.c_str(), "%f,%f,%f,%f", &fluidnc.wcoX, &fluidnc.wcoY, &fluidnc.wcoZ, &fluidnc.wcoA);
-        } else {
-            sscanf(wcoStr.c_str(), "%f,%f,%f", &fluidnc.wcoX, &fluidnc.wcoY, &fluidnc.wcoZ);
-            fluidnc.wcoA = 0;
-        }
+    resetLinkStats();
+
+    // Poll with '?' by default - $Report/Interval push reports are
+    // opt-in (cfg.fluidnc_auto_report) as older firmware lacks them
+    resetPollScheduler();
+}
+
+void fluidncTransportDisconnected() {
+    Serial.println("[FluidNC] Disconnected!");
+    fluidnc.connected = false;
+    fluidnc.machineState = MACHINE_OFFLINE;
+    fluidnc.machineSubstate = -1;
+    markFluidNCChanged(FNC_CHG_CONNECTION | FNC_CHG_STATE);
 
-        // Calculate WPos from MPos - WCO
-        fluidnc.wposX = fluidnc.posX - fluidnc.wcoX;
-        fluidnc.wposY = fluidnc.posY - fluidnc.wcoY;
-        fluidnc.wposZ = fluidnc.posZ - fluidnc.wcoZ;
-        fluidnc.wposA = fluidnc.posA - fluidnc.wcoA;
+    // Dropped by the controller (not by us) - back off and retry
+    if (linkState == LINK_UPGRADE || linkState == LINK_VERIFIED) {
+        linkFailed("Disconnected");
     }
+}
 
-    // Parse FS (Feed rate and Spindle speed)
-    int fsIndex = status.indexOf("FS:");
-    if (fsIndex >= 0) {
-        int endIndex = status.indexOf('|', fsIndex);
-        if (endIndex < 0) endIndex = status.indexOf('>', fsIndex);
-        String fsStr = status.substring(fsIndex + 3, endIndex);
-        sscanf(fsStr.c_str(), "%d,%d", &fluidnc.feedRate, &fluidnc.spindleRPM);
+void fluidncTransportMessage(const char* data, size_t length) {
+    if (fluidnc.debugWebSocket) {
+        Serial.printf("[FluidNC] RX %s (%d bytes): ", transport->name(), length);
+        Serial.write((const uint8_t*)data, length);
+        Serial.println();
     }
 
-    // Parse Ov (Overrides) if present
-    int ovIndex = status.indexOf("Ov:");
-    if (ovIndex >= 0) {
-        int endIndex = status.indexOf('|', ovIndex);
-        if (endIndex < 0) endIndex = status.indexOf('>', ovIndex);
-        String ovStr = status.substring(ovIndex + 3, endIndex);
-        sscanf(ovStr.c_str(), "%d,%d,%d", &fluidnc.feedOverride, &fluidnc.rapidOverride, &fluidnc.spindleOverride);
+    linkStatsMessage(length);
+
+    if (length > 0 && data[0] == '<') {
+        handleStatusFrame(data, length);
+    } else if (length >= 6 && strncmp(data, "ALARM:", 6) == 0) {
+        if (fluidnc.machineState != MACHINE_ALARM) {
+            fluidnc.machineState = MACHINE_ALARM;
+            fluidnc.machineSubstate = -1;
+            markFluidNCChanged(FNC_CHG_STATE);
+        }
     }
 }
 
+bool fluidncSend(const char* text) {
+    if (!fluidnc.connected) return false;
+    return transport->send(text);
+}
+
+const char* fluidncTransportName() {
+    return transport->name();
+}
+
 // ========== WebSocket Loop Handling ==========
 
 void handleWebSocketLoop() {
     // Only process WebSocket if connected to WiFi and connection was attempted
-    if (WiFi.status() != WL_CONNECTED || !fluidnc.connectionAttempted) {
+    if (!fluidnc.connectionAttempted) {
+        return;
+    }
+    if (transport->needsNetwork() && WiFi.status() != WL_CONNECTED) {
+        if (linkState != LINK_IDLE && linkState != LINK_BACKOFF) {
+            linkFailed("WiFi lost");
+        }
         return;
     }
 
-    // Process WebSocket events
-    yield();  // Yield before WebSocket operations
-    webSocket.loop();
-    yield();  // Yield after WebSocket operations
+    // Advance resolve/probe/backoff by one non-blocking step
+    serviceFluidNCLink();
 
-    // Poll for status if connected (FluidNC doesn't have automatic reporting)
-    if (fluidnc.connected && (millis() - timing.lastStatusRequest >= cfg.status_update_rate)) {
-        if (fluidnc.debugWebSocket) {
-            Serial.println("[FluidNC] Sending status request");
-        }
-        yield();  // Yield before send
-        webSocket.sendTXT("?");
-        yield();  // Yield after send
-        timing.lastStatusRequest = millis();
+    // The transport only runs once the probe found the host - the
+    // WebSocket library's connect() blocks for seconds against an unreachable one
+    if (linkState == LINK_UPGRADE || linkState == LINK_VERIFIED) {
+        transport->loop();
+    }
+
+    // Poll for status at the rate the machine state calls for
+    if (fluidnc.connected) {
+        servicePollScheduler();
     }
 
     // Periodic debug output (only every 10 seconds)
     static unsigned long lastDebug = 0;
     if (fluidnc.debugWebSocket && millis() - lastDebug >= 10000) {
         Serial.printf("[DEBUG] State:%s MPos:(%.2f,%.2f,%.2f,%.2f) WPos:(%.2f,%.2f,%.2f,%.2f)\n",
-                      fluidnc.machineState.c_str(),
+                      fluidnc.stateText,
                       fluidnc.posX, fluidnc.posY, fluidnc.posZ, fluidnc.posA,
                       fluidnc.wposX, fluidnc.wposY, fluidnc.wposZ, fluidnc.wposA);
+        printParseStats();
         lastDebug = millis();
     }
 }
+
+// ========== Network Task ==========
+
+#define NETWORK_TASK_STACK      8192
+#define NETWORK_TASK_PRIORITY   1
+#define NETWORK_TASK_CORE       0
+
+static TaskHandle_t networkTaskHandle = nullptr;
+
+static void networkTask(void* param) {
+    for (;;) {
+        // Web handlers report sensors from the latest core-1 snapshot
+        refreshSensorsView();
+        if (network.webServerStarted) {
+            server.handleClient();
+        }
+
+        handleWebSocketLoop();
+        updateLinkRates();
+
+        // Hand the new FluidNC state and link stats to the display core
+        publishFluidNCState();
+        publishLinkStats();
+
+        vTaskDelay(1);  // Let IDLE0 run (task watchdog)
+    }
+}
+
+void startNetworkTask() {
+    if (networkTaskHandle != nullptr) return;
+
+    BaseType_t ok = xTaskCreatePinnedToCore(networkTask, "network", NETWORK_TASK_STACK,
+                                            nullptr, NETWORK_TASK_PRIORITY,
+                                            &networkTaskHandle, NETWORK_TASK_CORE);
+    if (ok != pdPASS) {
+        Serial.println("[Network] ERROR: Failed to start network task");
+        networkTaskHandle = nullptr;
+        return;
+    }
+    Serial.printf("[Network] Task started on core %d\n", NETWORK_TASK_CORE);
+}
@@ -10,41 +10,32 @@
 // ========== WiFi Management ==========
 void setupWiFiManager();
 
-// ========== FluidNC WebSocket Client ==========
-void connectFluidNC();
-void discoverFluidNC();
-void fluidNCWebSocketEvent(WStype_t type, uint8_t * payload, size_t length);
-void parseFluidNCStatus(String status);
-
-// WebSocket loop handling (call from main loop)
+// ========== FluidNC Client ==========
+// Both only start the non-blocking connection state machine; progress is
+// made from handleWebSocketLoop(). The transport (WebSocket or raw TCP, see
+// fluidnc_transport.h) is picked from cfg.fluidnc_transport on each connect.
+void connectFluidNC();      // Connect to cfg.fluidnc_ip
+void discoverFluidNC();     // Resolve via mDNS (cached last-good address first)
+void disconnectFluidNC();
+const char* fluidncLinkStateName();  // "probe", "verified", "backoff", ...
+const char* fluidncTransportName();  // "websocket", "tcp"
+
+// Send a command over the active transport (false if not connected)
+bool fluidncSend(const char* text);
+// Status reports are parsed by parseFluidNCStatus() in status_parser.h
+
+// FluidNC link handling (called from the network task)
 void handleWebSocketLoop();
 
+// ========== Network Task ==========
+// Runs the web server and the FluidNC WebSocket client on core 0 so a slow
+// HTTP client or controller never delays sensors, fans or the display on
+// core 1. Call once at the end of setup().
+void startNetworkTask();
+
 // ========== External Variables ==========
-// These are defined in main.cpp and accessed by network functions
+// Defined in global_state.cpp; FluidNC status lives in the fluidnc struct
 extern WebSocketsClient webSocket;
 extern WiFiManager wm;
 
-// FluidNC status variables
-extern String machineState;
-extern float posX, posY, posZ, posA;
-extern float wposX, wposY, wposZ, wposA;
-extern int feedRate;
-extern int spindleRPM;
-extern bool fluidncConnected;
-extern unsigned long jobStartTime;
-extern bool isJobRunning;
-
-// Extended status fields
-extern int feedOverride;
-extern int rapidOverride;
-extern int spindleOverride;
-extern float wcoX, wcoY, wcoZ, wcoA;
-
-// WebSocket reporting
-extern bool autoReportingEnabled;
-extern unsigned long reportingSetupTime;
-
-// Debug control
-extern bool debugWebSocket;
-
 #endif // NETWORK_H
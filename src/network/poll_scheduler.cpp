@@ -0,0 +1,119 @@
+#include "poll_scheduler.h"
+#include "../state/global_state.h"
+#include "config/config.h"
+#include "link_stats.h"
+#include "network.h"
+
+static uint32_t seenStateVersion = 0;     // stateVersion at the last state-change check
+static bool burstActive = false;
+static unsigned long burstStart = 0;
+static unsigned long lastReportTime = 0;
+static uint16_t autoReportInterval = 0;   // Interval last requested from FluidNC
+
+// ========== Interval Selection ==========
+
+static uint16_t intervalForState(MachineState state) {
+    uint16_t fast = cfg.status_update_rate;
+    uint16_t slow = max(cfg.status_idle_rate, fast);
+
+    switch (state) {
+        case MACHINE_RUN:
+        case MACHINE_JOG:
+        case MACHINE_HOME:
+            return fast;
+
+        case MACHINE_IDLE:
+        case MACHINE_ALARM:
+        case MACHINE_SLEEP:
+            return slow;
+
+        default:  // HOLD, DOOR, CHECK, UNKNOWN
+            return constrain((uint16_t)POLL_MEDIUM_INTERVAL, fast, slow);
+    }
+}
+
+uint16_t currentPollInterval() {
+    if (burstActive) {
+        return cfg.status_update_rate;
+    }
+    return intervalForState(fluidnc.machineState);
+}
+
+// ========== Auto-Reporting ==========
+
+static void sendAutoReportInterval(uint16_t intervalMs) {
+    char cmd[32];
+    snprintf(cmd, sizeof(cmd), "$Report/Interval=%u\n", intervalMs);
+    if (fluidnc.debugWebSocket) {
+        Serial.printf("[FluidNC] Auto-report interval -> %u ms\n", intervalMs);
+    }
+    fluidncSend(cmd);
+    autoReportInterval = intervalMs;
+}
+
+// ========== Scheduler ==========
+
+void resetPollScheduler() {
+    unsigned long now = millis();
+
+    seenStateVersion = fluidnc.stateVersion;
+    burstActive = true;             // Fast updates right after connecting
+    burstStart = now;
+    lastReportTime = now;           // Grace period for the first pushed report
+    autoReportInterval = 0;
+    fluidnc.autoReportingEnabled = false;
+    fluidnc.reportingSetupTime = now;
+
+    if (cfg.fluidnc_auto_report) {
+        fluidnc.autoReportingEnabled = true;
+        sendAutoReportInterval(currentPollInterval());
+    }
+}
+
+void notePollReport() {
+    lastReportTime = millis();
+}
+
+void servicePollScheduler() {
+    unsigned long now = millis();
+
+    // Any state change (Idle -> Jog, Run -> Hold, ...) restarts the burst
+    if (fluidncChangesSince(fluidnc, seenStateVersion) & FNC_CHG_STATE) {
+        burstActive = true;
+        burstStart = now;
+    }
+    seenStateVersion = fluidnc.stateVersion;
+
+    if (burstActive && now - burstStart >= POLL_BURST_DURATION) {
+        burstActive = false;
+    }
+
+    uint16_t interval = currentPollInterval();
+
+    if (fluidnc.autoReportingEnabled) {
+        unsigned long timeout = max((unsigned long)AUTO_REPORT_TIMEOUT, 3UL * autoReportInterval);
+        if (now - lastReportTime < timeout) {
+            // FluidNC is pushing - just keep its interval in step with the state
+            if (interval != autoReportInterval) {
+                sendAutoReportInterval(interval);
+            }
+            return;
+        }
+
+        // Firmware without $Report/Interval (or reports stopped) - poll instead
+        Serial.println("[FluidNC] No auto-reports received - falling back to polling");
+        fluidnc.autoReportingEnabled = false;
+        sendAutoReportInterval(0);
+    }
+
+    if (now - timing.lastStatusRequest >= interval) {
+        if (fluidnc.debugWebSocket) {
+            Serial.printf("[FluidNC] Sending status request (interval %u ms)\n", interval);
+        }
+        yield();  // Yield before send
+        fluidncSend("?");
+        linkStatsPollSent();
+        yield();  // Yield after send
+        timing.lastStatusRequest = now;
+    }
+}
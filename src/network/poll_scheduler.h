@@ -0,0 +1,36 @@
+#ifndef POLL_SCHEDULER_H
+#define POLL_SCHEDULER_H
+
+#include <Arduino.h>
+
+// ========== Adaptive FluidNC Status Polling ==========
+// Picks the '?' poll interval from the machine state instead of polling at a
+// fixed rate:
+//   RUN / JOG / HOME        -> cfg.status_update_rate (fast)
+//   HOLD / DOOR / CHECK     -> POLL_MEDIUM_INTERVAL
+//   IDLE / ALARM / SLEEP    -> cfg.status_idle_rate (slow)
+// Every state change opens a short burst at the fast rate so the first
+// moves of a jog or job are not shown late.
+//
+// With cfg.fluidnc_auto_report set, FluidNC is asked to push reports itself
+// ($Report/Interval) and polling stops. If no report arrives within the
+// timeout, the scheduler falls back to polling until the next connection.
+
+#define POLL_MEDIUM_INTERVAL      500    // ms, paused/door states
+#define POLL_BURST_DURATION       2000   // ms at the fast rate after a state change
+#define AUTO_REPORT_TIMEOUT       3000   // ms without a pushed report before falling back
+
+// Call when the WebSocket connects (starts auto-reporting if configured)
+void resetPollScheduler();
+
+// Call for every status report successfully parsed
+void notePollReport();
+
+// Send a status request (or update the auto-report interval) when due.
+// Call from the WebSocket loop while connected.
+void servicePollScheduler();
+
+// Interval currently targeted for the machine state (ms)
+uint16_t currentPollInterval();
+
+#endif // POLL_SCHEDULER_H
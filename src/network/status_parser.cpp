@@ -0,0 +1,394 @@
+#include "status_parser.h"
+#include "../state/global_state.h"
+
+StatusParseStats parseStats = {};
+
+// ========== Token Helpers ==========
+// All helpers work on a [p, end) window of the original payload and never
+// write to it, so the WebSocket buffer can be parsed without copying.
+
+struct Token {
+    const char* p;
+    const char* end;
+};
+
+static bool tokenEquals(const Token& t, const char* literal) {
+    size_t len = strlen(literal);
+    return (size_t)(t.end - t.p) == len && memcmp(t.p, literal, len) == 0;
+}
+
+// Case-insensitive variant (FluidNC sends "Idle", the table holds "IDLE")
+static bool tokenEqualsNoCase(const Token& t, const char* literal) {
+    size_t len = strlen(literal);
+    return (size_t)(t.end - t.p) == len && strncasecmp(t.p, literal, len) == 0;
+}
+
+// Parse a signed decimal number ("-12.345"). Exponents are not used by FluidNC.
+static bool parseNumber(const char*& p, const char* end, float& out) {
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+
+    float value = 0.0f;
+    bool digits = false;
+    while (p < end && *p >= '0' && *p <= '9') {
+        value = value * 10.0f + (*p - '0');
+        digits = true;
+        p++;
+    }
+
+    if (p < end && *p == '.') {
+        p++;
+        float scale = 0.1f;
+        while (p < end && *p >= '0' && *p <= '9') {
+            value += (*p - '0') * scale;
+            scale *= 0.1f;
+            digits = true;
+            p++;
+        }
+    }
+
+    if (!digits) return false;
+    out = negative ? -value : value;
+    return true;
+}
+
+static bool parseInteger(const char*& p, const char* end, int32_t& out) {
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+
+    int32_t value = 0;
+    bool digits = false;
+    while (p < end && *p >= '0' && *p <= '9') {
+        value = value * 10 + (*p - '0');
+        digits = true;
+        p++;
+    }
+
+    // Tolerate a fractional part (e.g. "FS:500.0,0") by truncating it
+    if (p < end && *p == '.') {
+        p++;
+        while (p < end && *p >= '0' && *p <= '9') p++;
+    }
+
+    if (!digits) return false;
+    out = negative ? -value : value;
+    return true;
+}
+
+// Parse up to maxCount comma-separated floats. Returns the number parsed,
+// or 0 if the list is malformed.
+static int parseFloatList(Token t, float* out, int maxCount) {
+    const char* p = t.p;
+    int count = 0;
+    while (p < t.end && count < maxCount) {
+        if (!parseNumber(p, t.end, out[count])) return 0;
+        count++;
+        if (p < t.end) {
+            if (*p != ',') return 0;
+            p++;
+        }
+    }
+    return count;
+}
+
+static int parseIntList(Token t, int32_t* out, int maxCount) {
+    const char* p = t.p;
+    int count = 0;
+    while (p < t.end && count < maxCount) {
+        if (!parseInteger(p, t.end, out[count])) return 0;
+        count++;
+        if (p < t.end) {
+            if (*p != ',') return 0;
+            p++;
+        }
+    }
+    return count;
+}
+
+// ========== Change Tracking ==========
+// Fields are only written when their value differs, and every write records
+// its FNC_CHG_* group so the whole report can be published as one change mask.
+
+static uint32_t pendingChanges = 0;
+
+template <typename T>
+static void updateField(T& dest, T value, uint32_t change) {
+    if (dest != value) {
+        dest = value;
+        pendingChanges |= change;
+    }
+}
+
+// Copy a token into a fixed char buffer (truncating)
+static void updateText(Token t, char* dest, size_t destSize, uint32_t change) {
+    size_t len = t.end - t.p;
+    if (len >= destSize) len = destSize - 1;
+    if (strncmp(dest, t.p, len) == 0 && dest[len] == '\0') return;
+    memcpy(dest, t.p, len);
+    dest[len] = '\0';
+    pendingChanges |= change;
+}
+
+static void clearText(char* dest, uint32_t change) {
+    if (dest[0] != '\0') {
+        dest[0] = '\0';
+        pendingChanges |= change;
+    }
+}
+
+// Parse an axis list into x/y/z/a. 3-axis reports leave A at zero.
+static bool parseAxes(Token t, float& x, float& y, float& z, float& a, uint32_t change) {
+    float v[6];
+    int n = parseFloatList(t, v, 6);
+    if (n < 3) return false;
+    updateField(x, v[0], change);
+    updateField(y, v[1], change);
+    updateField(z, v[2], change);
+    updateField(a, (n >= 4) ? v[3] : 0.0f, change);
+    return true;
+}
+
+// ========== Field Handlers ==========
+
+static bool parseStateField(Token t) {
+    if (t.p == t.end) return false;
+
+    // Split "Hold:0" into name and reason code
+    const char* colon = (const char*)memchr(t.p, ':', t.end - t.p);
+    Token name = {t.p, colon ? colon : t.end};
+
+    MachineState state = MACHINE_UNKNOWN;
+    for (uint8_t i = MACHINE_IDLE; i < MACHINE_UNKNOWN; i++) {
+        if (tokenEqualsNoCase(name, machineStateName((MachineState)i))) {
+            state = (MachineState)i;
+            break;
+        }
+    }
+
+    int32_t substate = -1;
+    if (colon != nullptr) {
+        const char* p = colon + 1;
+        if (!parseInteger(p, t.end, substate) || substate < 0 || substate > 127) {
+            substate = -1;
+        }
+    }
+
+    bool wasRunning = (fluidnc.machineState == MACHINE_RUN);
+    updateField(fluidnc.machineState, state, FNC_CHG_STATE);
+    updateField(fluidnc.machineSubstate, (int8_t)substate, FNC_CHG_STATE);
+
+    // Job tracking
+    bool isRunning = (state == MACHINE_RUN);
+    if (!wasRunning && isRunning) {
+        fluidnc.jobStartTime = millis();
+        fluidnc.isJobRunning = true;
+    }
+    if (wasRunning && !isRunning) {
+        fluidnc.isJobRunning = false;
+    }
+    return true;
+}
+
+static bool parseFeedSpindle(Token t) {
+    int32_t v[2];
+    int n = parseIntList(t, v, 2);
+    if (n < 1) return false;
+    updateField(fluidnc.feedRate, (int)v[0], FNC_CHG_FEED);
+    if (n >= 2) updateField(fluidnc.spindleRPM, (int)v[1], FNC_CHG_FEED);
+    return true;
+}
+
+static bool parseOverrides(Token t) {
+    int32_t v[3];
+    if (parseIntList(t, v, 3) != 3) return false;
+    updateField(fluidnc.feedOverride, (int)v[0], FNC_CHG_OVERRIDES);
+    updateField(fluidnc.rapidOverride, (int)v[1], FNC_CHG_OVERRIDES);
+    updateField(fluidnc.spindleOverride, (int)v[2], FNC_CHG_OVERRIDES);
+    return true;
+}
+
+static bool parseBuffer(Token t) {
+    int32_t v[2];
+    if (parseIntList(t, v, 2) != 2) return false;
+    updateField(fluidnc.plannerBlocks, (int)v[0], FNC_CHG_BUFFER);
+    updateField(fluidnc.rxBufferBytes, (int)v[1], FNC_CHG_BUFFER);
+    return true;
+}
+
+static bool parseLineNumber(Token t) {
+    const char* p = t.p;
+    int32_t line;
+    if (!parseInteger(p, t.end, line) || p != t.end) return false;
+    updateField(fluidnc.lineNumber, line, FNC_CHG_LINE);
+    return true;
+}
+
+// SD:<percent>,<filename>
+static bool parseSDProgress(Token t) {
+    const char* p = t.p;
+    float percent;
+    if (!parseNumber(p, t.end, percent)) return false;
+    updateField(fluidnc.sdPercent, percent, FNC_CHG_SD);
+    if (p < t.end && *p == ',') {
+        updateText({p + 1, t.end}, fluidnc.sdFilename, sizeof(fluidnc.sdFilename), FNC_CHG_SD);
+    } else {
+        clearText(fluidnc.sdFilename, FNC_CHG_SD);
+    }
+    return true;
+}
+
+// ========== Report Parser ==========
+
+bool parseFluidNCStatus(const char* data, size_t length) {
+    const char* end = data + length;
+
+    // Locate the report brackets (frames may carry a trailing "\r\n" or
+    // follow other output such as "ok")
+    const char* open = (const char*)memchr(data, '<', length);
+    if (open == nullptr) {
+        return false;  // Not a status report
+    }
+    const char* close = (const char*)memchr(open, '>', end - open);
+    if (close == nullptr) {
+        parseStats.malformed++;
+        return false;
+    }
+
+    const char* p = open + 1;
+    bool seen[FIELD_COUNT] = {false};
+    pendingChanges = 0;
+    bool first = true;
+
+    while (p <= close) {
+        const char* sep = p;
+        while (sep < close && *sep != '|') sep++;
+        Token tok = {p, sep};
+        p = sep + 1;
+
+        if (first) {
+            first = false;
+            if (!parseStateField(tok)) {
+                parseStats.malformed++;
+                parseStats.errors[FIELD_STATE]++;
+                markFluidNCChanged(pendingChanges);
+                return false;
+            }
+            parseStats.parsed[FIELD_STATE]++;
+            seen[FIELD_STATE] = true;
+            continue;
+        }
+
+        const char* colon = (const char*)memchr(tok.p, ':', tok.end - tok.p);
+        if (colon == nullptr) {
+            parseStats.errors[FIELD_UNKNOWN]++;
+            continue;
+        }
+        Token name = {tok.p, colon};
+        Token value = {colon + 1, tok.end};
+
+        // Unrecognised fields are skipped and counted under FIELD_UNKNOWN
+        StatusField field = FIELD_UNKNOWN;
+        bool ok = true;
+
+        if (tokenEquals(name, "MPos")) {
+            field = FIELD_MPOS;
+            ok = parseAxes(value, fluidnc.posX, fluidnc.posY, fluidnc.posZ, fluidnc.posA, FNC_CHG_MPOS);
+        } else if (tokenEquals(name, "WPos")) {
+            field = FIELD_WPOS;
+            ok = parseAxes(value, fluidnc.wposX, fluidnc.wposY, fluidnc.wposZ, fluidnc.wposA, FNC_CHG_WPOS);
+        } else if (tokenEquals(name, "WCO")) {
+            field = FIELD_WCO;
+            ok = parseAxes(value, fluidnc.wcoX, fluidnc.wcoY, fluidnc.wcoZ, fluidnc.wcoA, FNC_CHG_WCO);
+        } else if (tokenEquals(name, "FS") || tokenEquals(name, "F")) {
+            field = FIELD_FS;
+            ok = parseFeedSpindle(value);
+        } else if (tokenEquals(name, "Ov")) {
+            field = FIELD_OV;
+            ok = parseOverrides(value);
+        } else if (tokenEquals(name, "Bf")) {
+            field = FIELD_BF;
+            ok = parseBuffer(value);
+        } else if (tokenEquals(name, "Ln")) {
+            field = FIELD_LN;
+            ok = parseLineNumber(value);
+        } else if (tokenEquals(name, "Pn")) {
+            field = FIELD_PN;
+            updateText(value, fluidnc.pins, sizeof(fluidnc.pins), FNC_CHG_PINS);
+        } else if (tokenEquals(name, "A")) {
+            field = FIELD_A;
+            updateText(value, fluidnc.accessories, sizeof(fluidnc.accessories), FNC_CHG_ACCESSORY);
+        } else if (tokenEquals(name, "SD")) {
+            field = FIELD_SD;
+            ok = parseSDProgress(value);
+        }
+
+        if (ok) {
+            parseStats.parsed[field]++;
+            seen[field] = true;
+        } else {
+            parseStats.errors[field]++;
+        }
+    }
+
+    // Work position: FluidNC sends either WPos or MPos (+ WCO every few
+    // reports). Derive WPos from the last known offset when only MPos arrives.
+    if (!seen[FIELD_WPOS] && seen[FIELD_MPOS]) {
+        updateField(fluidnc.wposX, fluidnc.posX - fluidnc.wcoX, FNC_CHG_WPOS);
+        updateField(fluidnc.wposY, fluidnc.posY - fluidnc.wcoY, FNC_CHG_WPOS);
+        updateField(fluidnc.wposZ, fluidnc.posZ - fluidnc.wcoZ, FNC_CHG_WPOS);
+        updateField(fluidnc.wposA, fluidnc.posA - fluidnc.wcoA, FNC_CHG_WPOS);
+    } else if (seen[FIELD_WPOS] && !seen[FIELD_MPOS]) {
+        updateField(fluidnc.posX, fluidnc.wposX + fluidnc.wcoX, FNC_CHG_MPOS);
+        updateField(fluidnc.posY, fluidnc.wposY + fluidnc.wcoY, FNC_CHG_MPOS);
+        updateField(fluidnc.posZ, fluidnc.wposZ + fluidnc.wcoZ, FNC_CHG_MPOS);
+        updateField(fluidnc.posA, fluidnc.wposA + fluidnc.wcoA, FNC_CHG_MPOS);
+    }
+
+    // Pn/A/SD are only reported while active - absence means cleared
+    if (!seen[FIELD_PN]) clearText(fluidnc.pins, FNC_CHG_PINS);
+    if (!seen[FIELD_A]) clearText(fluidnc.accessories, FNC_CHG_ACCESSORY);
+    if (!seen[FIELD_SD]) {
+        updateField(fluidnc.sdPercent, -1.0f, FNC_CHG_SD);
+        clearText(fluidnc.sdFilename, FNC_CHG_SD);
+    }
+
+    // Every report counts for the DRO motion estimator, even an unchanged
+    // one - it is what tells the estimator the axes have stopped
+    fluidnc.reportCount++;
+    fluidnc.reportTime = millis();
+
+    // Publish everything this report changed as a single state version
+    markFluidNCChanged(pendingChanges);
+
+    parseStats.reports++;
+    return true;
+}
+
+// ========== Statistics ==========
+
+const char* statusFieldName(StatusField field) {
+    static const char* const names[FIELD_COUNT] = {
+        "State", "MPos", "WPos", "WCO", "FS", "Ov", "Bf", "Ln", "Pn", "A", "SD", "Unknown"
+    };
+    return field < FIELD_COUNT ? names[field] : "?";
+}
+
+void resetParseStats() {
+    memset(&parseStats, 0, sizeof(parseStats));
+}
+
+void printParseStats() {
+    Serial.printf("[FluidNC] Parser: %u reports, %u malformed\n",
+                  parseStats.reports, parseStats.malformed);
+    for (int i = 0; i < FIELD_COUNT; i++) {
+        if (parseStats.parsed[i] == 0 && parseStats.errors[i] == 0) continue;
+        Serial.printf("[FluidNC]   %-7s ok:%u err:%u\n",
+                      statusFieldName((StatusField)i), parseStats.parsed[i], parseStats.errors[i]);
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef STATUS_PARSER_H
+#define STATUS_PARSER_H
+
+#include <Arduino.h>
+
+// ========== FluidNC Status Report Parser ==========
+// Single-pass tokenizer for FluidNC/Grbl real-time status reports:
+//   <Run|MPos:1.000,2.000,3.000|Bf:15,128|FS:500,8000|Ov:100,100,100|A:S|Pn:XZ>
+// Parses in place from the WebSocket payload buffer (no String, no heap)
+// and writes the result straight into the global FluidNCState.
+
+// Report fields, in the order they are counted in StatusParseStats
+enum StatusField : uint8_t {
+    FIELD_STATE = 0,    // Idle, Run, Hold:0, Door:1, ...
+    FIELD_MPOS,         // MPos:x,y,z[,a]
+    FIELD_WPOS,         // WPos:x,y,z[,a]
+    FIELD_WCO,          // WCO:x,y,z[,a]
+    FIELD_FS,           // FS:feed,spindle (or F:feed)
+    FIELD_OV,           // Ov:feed,rapid,spindle
+    FIELD_BF,           // Bf:blocks,bytes
+    FIELD_LN,           // Ln:line
+    FIELD_PN,           // Pn:XYZPDHRS
+    FIELD_A,            // A:SCFM
+    FIELD_SD,           // SD:percent,filename
+    FIELD_UNKNOWN,      // Anything we don't recognise (skipped)
+    FIELD_COUNT
+};
+
+// Per-field parse statistics (reset with resetParseStats())
+struct StatusParseStats {
+    uint32_t reports;                 // Complete <...> reports parsed
+    uint32_t malformed;               // Reports rejected (no closing '>', empty state)
+    uint32_t parsed[FIELD_COUNT];     // Fields parsed successfully
+    uint32_t errors[FIELD_COUNT];     // Fields present but unparseable
+};
+extern StatusParseStats parseStats;
+
+// Parse a status report from a raw buffer (need not be null-terminated).
+// Returns false if the buffer does not contain a complete <...> report.
+bool parseFluidNCStatus(const char* data, size_t length);
+
+// Field name for logging/JSON ("MPos", "FS", ...)
+const char* statusFieldName(StatusField field);
+
+// Statistics helpers
+void resetParseStats();
+void printParseStats();
+
+#endif // STATUS_PARSER_H
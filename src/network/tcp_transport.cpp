@@ -0,0 +1,126 @@
+#include "tcp_transport.h"
+#include "config/config.h"
+#include <lwip/sockets.h>
+
+#define TCP_RECV_BURST 4    // recv() calls per loop() before yielding
+
+TcpTransport tcpTransport;
+
+uint16_t TcpTransport::port() const {
+    return cfg.fluidnc_tcp_port;
+}
+
+void TcpTransport::begin(const char* host) {
+    closeSocket();
+    _lines.reset();
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port());
+    if (inet_pton(AF_INET, host, &addr.sin_addr) != 1) {
+        Serial.printf("[FluidNC] Invalid address: %s\n", host);
+        fluidncTransportDisconnected();
+        return;
+    }
+
+    Serial.printf("[FluidNC] Opening tcp://%s:%d\n", host, port());
+    _socket = socket(AF_INET, SOCK_STREAM, 0);
+    if (_socket < 0) {
+        fluidncTransportDisconnected();
+        return;
+    }
+    fcntl(_socket, F_SETFL, fcntl(_socket, F_GETFL, 0) | O_NONBLOCK);
+
+    // Status polls are single bytes - don't let Nagle hold them back
+    int noDelay = 1;
+    setsockopt(_socket, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+    if (connect(_socket, (struct sockaddr*)&addr, sizeof(addr)) == 0) {
+        _connected = true;
+        fluidncTransportConnected();
+    } else if (errno == EINPROGRESS) {
+        _connecting = true;
+    } else {
+        closeSocket();
+        fluidncTransportDisconnected();
+    }
+}
+
+void TcpTransport::end() {
+    bool wasConnected = _connected;
+    closeSocket();
+    if (wasConnected) {
+        fluidncTransportDisconnected();
+    }
+}
+
+void TcpTransport::closeSocket() {
+    if (_socket >= 0) {
+        close(_socket);
+        _socket = -1;
+    }
+    _connecting = false;
+    _connected = false;
+}
+
+void TcpTransport::loop() {
+    if (_connecting) {
+        serviceConnect();
+    }
+    if (_connected) {
+        serviceReceive();
+    }
+}
+
+void TcpTransport::serviceConnect() {
+    fd_set writeSet;
+    FD_ZERO(&writeSet);
+    FD_SET(_socket, &writeSet);
+    struct timeval tv = {0, 0};
+    if (select(_socket + 1, nullptr, &writeSet, nullptr, &tv) <= 0) {
+        return;  // Still connecting - the link state machine owns the timeout
+    }
+
+    int err = 0;
+    socklen_t len = sizeof(err);
+    getsockopt(_socket, SOL_SOCKET, SO_ERROR, &err, &len);
+    if (err != 0) {
+        closeSocket();
+        fluidncTransportDisconnected();
+        return;
+    }
+
+    _connecting = false;
+    _connected = true;
+    Serial.println("[FluidNC] TCP connected");
+    fluidncTransportConnected();
+}
+
+static void dispatchLine(const char* line, size_t length) {
+    fluidncTransportMessage(line, length);
+}
+
+void TcpTransport::serviceReceive() {
+    for (uint8_t i = 0; i < TCP_RECV_BURST && _socket >= 0; i++) {
+        int n = recv(_socket, _lines.writePtr(), _lines.writeSpace(), MSG_DONTWAIT);
+        if (n > 0) {
+            _lines.commit(n, dispatchLine);
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return;  // Drained
+        }
+
+        // 0 = closed by FluidNC, < 0 = reset
+        Serial.println("[FluidNC] TCP connection closed");
+        end();
+        return;
+    }
+}
+
+bool TcpTransport::send(const char* text) {
+    if (!_connected) return false;
+    size_t length = strlen(text);
+    return ::send(_socket, text, length, MSG_DONTWAIT) == (int)length;
+}
@@ -0,0 +1,41 @@
+#ifndef TCP_TRANSPORT_H
+#define TCP_TRANSPORT_H
+
+#include "fluidnc_transport.h"
+#include "line_assembler.h"
+
+// ========== Raw TCP Transport ==========
+// FluidNC's telnet port (cfg.fluidnc_tcp_port, 23 by default): a plain
+// line stream with no WebSocket framing, and it does not compete with the
+// controller's own web UI for its WebSocket server. Non-blocking lwIP
+// socket; lines are reassembled in place by LineAssembler.
+
+class TcpTransport : public FluidNCTransport {
+public:
+    TcpTransport() : _socket(-1), _connecting(false), _connected(false) {}
+
+    const char* name() const { return "tcp"; }
+    uint16_t port() const;
+    bool needsProbe() const { return false; }  // Connect is already non-blocking
+
+    void begin(const char* host);
+    void end();
+    void loop();
+    bool send(const char* text);
+
+    uint32_t lineOverflows() const { return _lines.overflows(); }
+
+private:
+    void closeSocket();
+    void serviceConnect();
+    void serviceReceive();
+
+    int _socket;
+    bool _connecting;
+    bool _connected;
+    LineAssembler _lines;
+};
+
+extern TcpTransport tcpTransport;
+
+#endif // TCP_TRANSPORT_H
@@ -0,0 +1,96 @@
+#include "uart_transport.h"
+#include "config/config.h"
+#include "config/pins.h"
+
+UartTransport uartTransport(Serial2);
+
+static uint32_t framingErrorCount = 0;
+static uint32_t resyncCount = 0;
+
+// ========== Framing Recovery ==========
+
+static void dispatchUartLine(const char* line, size_t length) {
+    // Noise or a reset mid-report leaves a fragment in front of the next
+    // one - restart at the last '<'
+    size_t start = length;
+    while (start > 0 && line[start - 1] != '<') start--;
+    if (start > 1) {
+        line += start - 1;
+        length -= start - 1;
+        resyncCount++;
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        uint8_t c = (uint8_t)line[i];
+        if ((c < 0x20 && c != '\t') || c >= 0x7F) {
+            framingErrorCount++;  // Baud mismatch or line noise
+            return;
+        }
+    }
+
+    fluidncTransportMessage(line, length);
+}
+
+// ========== Transport ==========
+
+void UartTransport::begin(const char* host) {
+    (void)host;
+    if (_serial != nullptr) {
+        Serial.printf("[FluidNC] Opening UART (RX %d, TX %d, %lu baud)\n",
+                      FLUIDNC_UART_RX, FLUIDNC_UART_TX, (unsigned long)cfg.fluidnc_baud);
+        _serial->end();
+        _serial->setRxBufferSize(UART_RX_BUFFER);  // Must precede begin()
+        _serial->begin(cfg.fluidnc_baud, SERIAL_8N1, FLUIDNC_UART_RX, FLUIDNC_UART_TX);
+    }
+
+    // Whatever arrived before we were listening is a partial line at best
+    while (_stream->available() > 0) _stream->read();
+    _lines.reset();
+
+    // No handshake on a serial line - the first parsed report verifies it
+    _connected = true;
+    _lastRx = millis();
+    fluidncTransportConnected();
+}
+
+void UartTransport::end() {
+    if (!_connected) return;
+    _connected = false;
+    if (_serial != nullptr) {
+        _serial->end();
+    }
+    fluidncTransportDisconnected();
+}
+
+void UartTransport::loop() {
+    if (!_connected) return;
+
+    int available = _stream->available();
+    while (available > 0) {
+        size_t n = min((size_t)available, _lines.writeSpace());
+        n = _stream->readBytes(_lines.writePtr(), n);
+        if (n == 0) break;
+        _lines.commit(n, dispatchUartLine);
+        _lastRx = millis();
+        available = _stream->available();
+    }
+
+    if (millis() - _lastRx >= UART_SILENCE_TIMEOUT) {
+        Serial.println("[FluidNC] UART silent - controller off or unplugged?");
+        end();
+    }
+}
+
+bool UartTransport::send(const char* text) {
+    if (!_connected) return false;
+    size_t length = strlen(text);
+    return _stream->write((const uint8_t*)text, length) == length;
+}
+
+uint32_t UartTransport::framingErrors() const {
+    return framingErrorCount;
+}
+
+uint32_t UartTransport::resyncs() const {
+    return resyncCount;
+}
@@ -0,0 +1,58 @@
+#ifndef UART_TRANSPORT_H
+#define UART_TRANSPORT_H
+
+#include "fluidnc_transport.h"
+#include "line_assembler.h"
+
+// ========== UART Transport ==========
+// Wired link for a controller next to the dashboard: FluidNC's serial
+// console on FLUIDNC_UART_RX/TX at cfg.fluidnc_baud. No WiFi involved, so
+// latency stays deterministic on a congested network.
+//
+// The ESP32 UART driver moves RX bytes from the hardware FIFO into a ring
+// buffer (UART_RX_BUFFER) by interrupt; loop() drains it in bulk into a
+// LineAssembler. Framing recovery after noise or a controller reset:
+//   - junk in front of a report is skipped (resync on the last '<')
+//   - lines with control/non-ASCII bytes are dropped
+//   - silence for UART_SILENCE_TIMEOUT is reported as a disconnect
+//
+// The byte source is a Stream, so an already-open stream (e.g. a Linux
+// pseudo-terminal standing in for the controller) can replace the UART.
+
+#define UART_RX_BUFFER          1024    // Driver ring buffer (bytes)
+#define UART_SILENCE_TIMEOUT    5000    // ms without any byte while connected
+
+class UartTransport : public FluidNCTransport {
+public:
+    // Opens/closes the UART itself
+    explicit UartTransport(HardwareSerial& serial) : _serial(&serial), _stream(&serial),
+        _connected(false), _lastRx(0) {}
+    // Pre-opened stream - begin()/end() only start and stop reading
+    explicit UartTransport(Stream& stream) : _serial(nullptr), _stream(&stream),
+        _connected(false), _lastRx(0) {}
+
+    const char* name() const { return "uart"; }
+    uint16_t port() const { return 0; }
+    bool needsProbe() const { return false; }
+    bool needsNetwork() const { return false; }
+
+    void begin(const char* host);   // host is ignored
+    void end();
+    void loop();
+    bool send(const char* text);
+
+    uint32_t framingErrors() const;
+    uint32_t resyncs() const;
+    uint32_t lineOverflows() const { return _lines.overflows(); }
+
+private:
+    HardwareSerial* _serial;
+    Stream* _stream;
+    bool _connected;
+    unsigned long _lastRx;
+    LineAssembler _lines;
+};
+
+extern UartTransport uartTransport;
+
+#endif // UART_TRANSPORT_H
@@ -0,0 +1,69 @@
+#include "websocket_transport.h"
+#include "../state/global_state.h"
+#include "config/config.h"
+#include <WebSocketsClient.h>
+
+WebSocketTransport webSocketTransport;
+
+static void webSocketEvent(WStype_t type, uint8_t * payload, size_t length) {
+    switch(type) {
+        case WStype_DISCONNECTED:
+            fluidncTransportDisconnected();
+            break;
+
+        case WStype_CONNECTED:
+            Serial.printf("[FluidNC] Connected to: %s\n", payload);
+            fluidncTransportConnected();
+            break;
+
+        case WStype_TEXT:
+        case WStype_BIN:
+            // FluidNC sends status as BINARY data - parsed in place (the
+            // payload is not null-terminated, the parser is bounded by length)
+            fluidncTransportMessage((const char*)payload, length);
+            break;
+
+        case WStype_ERROR:
+            Serial.println("[FluidNC] WebSocket Error!");
+            break;
+
+        case WStype_PING:
+        case WStype_PONG:
+            // Ping/pong for keep-alive - normal, no logging needed
+            break;
+
+        default:
+            if (fluidnc.debugWebSocket) {
+                Serial.printf("[FluidNC] Event type: %d\n", type);
+            }
+            break;
+    }
+}
+
+uint16_t WebSocketTransport::port() const {
+    return cfg.fluidnc_port;
+}
+
+void WebSocketTransport::begin(const char* host) {
+    Serial.printf("[FluidNC] Opening ws://%s:%d/ws\n", host, port());
+    if (!_eventsRegistered) {
+        webSocket.onEvent(webSocketEvent);
+        _eventsRegistered = true;
+    }
+    webSocket.begin(host, port(), "/ws");
+    webSocket.setReconnectInterval(5000);
+}
+
+void WebSocketTransport::end() {
+    webSocket.disconnect();  // Raises WStype_DISCONNECTED if it was connected
+}
+
+void WebSocketTransport::loop() {
+    yield();  // Yield before WebSocket operations
+    webSocket.loop();
+    yield();  // Yield after WebSocket operations
+}
+
+bool WebSocketTransport::send(const char* text) {
+    return webSocket.sendTXT(text);
+}
@@ -0,0 +1,29 @@
+#ifndef WEBSOCKET_TRANSPORT_H
+#define WEBSOCKET_TRANSPORT_H
+
+#include "fluidnc_transport.h"
+
+// ========== WebSocket Transport ==========
+// FluidNC's web UI socket (ws://host:cfg.fluidnc_port/ws). Each TEXT/BIN
+// frame is passed on as one message.
+
+class WebSocketTransport : public FluidNCTransport {
+public:
+    WebSocketTransport() : _eventsRegistered(false) {}
+
+    const char* name() const { return "websocket"; }
+    uint16_t port() const;
+    bool needsProbe() const { return true; }   // The library's connect() blocks
+
+    void begin(const char* host);
+    void end();
+    void loop();
+    bool send(const char* text);
+
+private:
+    bool _eventsRegistered;
+};
+
+extern WebSocketTransport webSocketTransport;
+
+#endif // WEBSOCKET_TRANSPORT_H
@@ -2,10 +2,13 @@
 #include "../state/global_state.h"
 #include "config/pins.h"
 #include "config/config.h"
+#include "utils/utils.h"
 #include <Arduino.h>
 #include <OneWire.h>
 #include <DallasTemperature.h>
 #include <esp_task_wdt.h>  // For explicit watchdog timer reset
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 
 // ========== DS18B20 OneWire Setup ==========
 OneWire oneWire(ONE_WIRE_BUS_1);
@@ -14,6 +17,22 @@ DallasTemperature ds18b20Sensors(&oneWire);
 // Sensor mappings vector (stores UID to friendly name mappings)
 std::vector<SensorMapping> sensorMappings;
 
+// Guards oneWire/ds18b20Sensors and sensorMappings across cores
+static SemaphoreHandle_t sensorBusMutex = nullptr;
+
+// ========== Bus Locking ==========
+
+bool lockSensorBus(uint32_t waitMs) {
+  if (sensorBusMutex == nullptr) return true;  // Before init - single task
+  TickType_t ticks = (waitMs == SENSOR_BUS_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(waitMs);
+  return xSemaphoreTakeRecursive(sensorBusMutex, ticks) == pdTRUE;
+}
+
+void unlockSensorBus() {
+  if (sensorBusMutex == nullptr) return;
+  xSemaphoreGiveRecursive(sensorBusMutex);
+}
+
 // ========== Temperature Monitoring ==========
 
 // Legacy function - now just calls non-blocking version
@@ -48,8 +67,11 @@ void updateTempHistory() {
     }
   }
 
+  // /api/history reads the ring from the network task
+  HistoryLock lock;
   history.tempHistory[history.historyIndex] = maxTemp;
   history.historyIndex = (history.historyIndex + 1) % history.historySize;
+  history.sampleCount++;
 }
 
 // ========== Fan Control ==========
@@ -114,10 +136,8 @@ void sampleSensorsNonBlocking() {
   }
 }
 
-// Process averaged ADC readings (called when adcReady is true)
-// Calculates PSU voltage from averaged ADC samples and reads DS18B20 sensors
-void processAdcReadings() {
-  // Read DS18B20 temperature sensors
+// Read the DS18B20s into sensors.temperatures by display position (bus lock held)
+static void readMappedTemperatures() {
   ds18b20Sensors.requestTemperatures();  // Request readings from all sensors
 
   // Update temperatures array with readings from mapped sensors
@@ -155,6 +175,25 @@ void processAdcReadings() {
     }
   }
 
+  sensors.tempVersion++;
+}
+
+// Start a DS18B20 conversion without holding the bus for the wait
+static void requestTemperaturesLocked() {
+  SensorBusLock busLock;
+  ds18b20Sensors.requestTemperatures();
+}
+
+// Process averaged ADC readings (called when adcReady is true)
+// Calculates PSU voltage from averaged ADC samples and reads DS18B20 sensors
+void processAdcReadings() {
+  // Skip the DS18B20 update this round if a web request (discovery, touch
+  // detection) holds the bus - the PSU reading below doesn't need it
+  SensorBusLock busLock(0);
+  if (busLock.locked()) {
+    readMappedTemperatures();
+  }
+
   // Process PSU voltage
   uint32_t sum = 0;
   for (int i = 0; i < 10; i++) {
@@ -174,6 +213,10 @@ void processAdcReadings() {
 void initDS18B20Sensors() {
   Serial.println("[SENSORS] Initializing DS18B20 sensors...");
 
+  if (sensorBusMutex == nullptr) {
+    sensorBusMutex = xSemaphoreCreateRecursiveMutex();
+  }
+
   ds18b20Sensors.begin();
   int deviceCount = ds18b20Sensors.getDeviceCount();
 
@@ -208,6 +251,7 @@ int getSensorCount() {
 
 // Get temperature by alias (e.g., "temp0")
 float getTempByAlias(const char* alias) {
+  SensorBusLock busLock;
   for (const auto& mapping : sensorMappings) {
     if (strcmp(mapping.alias, alias) == 0 && mapping.enabled) {
       float temp = ds18b20Sensors.getTempC(mapping.uid);
@@ -221,6 +265,7 @@ float getTempByAlias(const char* alias) {
 
 // Get temperature by UID
 float getTempByUID(const uint8_t uid[8]) {
+  SensorBusLock busLock;
   float temp = ds18b20Sensors.getTempC(uid);
   if (temp != DEVICE_DISCONNECTED_C && temp > -55.0 && temp < 125.0) {
     return temp;
@@ -238,6 +283,7 @@ std::vector<String> getDiscoveredUIDs() {
 
   Serial.println("[SENSORS] Scanning OneWire bus for DS18B20 sensors...");
 
+  SensorBusLock busLock;
   oneWire.reset_search();
   while (oneWire.search(addr)) {
     // Verify CRC
@@ -295,6 +341,7 @@ extern Preferences prefs;  // Defined in main.cpp
 void loadSensorConfig() {
   Serial.println("[SENSORS] Loading sensor configuration from NVS...");
 
+  SensorBusLock busLock;
   prefs.begin("sensors", true);  // Read-only mode
 
   // Clear existing mappings
@@ -354,6 +401,7 @@ void loadSensorConfig() {
 void saveSensorConfig() {
   Serial.println("[SENSORS] Saving sensor configuration to NVS...");
 
+  SensorBusLock busLock;
   prefs.begin("sensors", false);  // Read-write mode
 
   // Clear all existing sensor keys first
@@ -394,6 +442,8 @@ void saveSensorConfig() {
 // Add or update sensor mapping
 // If UID already exists, update it. Otherwise, add new mapping.
 bool addSensorMapping(const uint8_t uid[8], const char* name, const char* alias) {
+  SensorBusLock busLock;
+
   // Check if sensor with this UID already exists
   for (auto& mapping : sensorMappings) {
     if (memcmp(mapping.uid, uid, 8) == 0) {
@@ -423,6 +473,7 @@ bool addSensorMapping(const uint8_t uid[8], const char* name, const char* alias)
 
 // Remove sensor mapping by alias
 bool removeSensorMapping(const char* alias) {
+  SensorBusLock busLock;
   for (auto it = sensorMappings.begin(); it != sensorMappings.end(); ++it) {
     if (strcmp(it->alias, alias) == 0) {
       Serial.printf("[SENSORS] Removed mapping: %s\n", alias);
@@ -446,7 +497,7 @@ String detectTouchedSensor(unsigned long timeoutMs, float thresholdDelta) {
   std::vector<float> baselines;
 
   Serial.println("[SENSORS] Establishing temperature baselines...");
-  ds18b20Sensors.requestTemperatures();
+  requestTemperaturesLocked();
 
   // Non-blocking wait for conversion (12-bit resolution takes 750ms)
   unsigned long conversionStart = millis();
@@ -469,7 +520,7 @@ String detectTouchedSensor(unsigned long timeoutMs, float thresholdDelta) {
   Serial.println("[SENSORS] Monitoring for temperature changes... (touch a sensor)");
 
   while (millis() - startTime < timeoutMs) {
-    ds18b20Sensors.requestTemperatures();
+    requestTemperaturesLocked();
 
     // Non-blocking wait for conversion with watchdog feeding
     conversionStart = millis();
@@ -505,6 +556,8 @@ String detectTouchedSensor(unsigned long timeoutMs, float thresholdDelta) {
 // Assign sensor UID to a display position (0=X, 1=YL, 2=YR, 3=Z)
 // First clears any existing sensor at that position
 bool assignSensorToPosition(const uint8_t uid[8], int8_t position) {
+  SensorBusLock busLock;
+
   // Clear any sensor currently at this position
   for (auto& mapping : sensorMappings) {
     if (mapping.displayPosition == position) {
@@ -559,6 +612,7 @@ bool assignSensorToPosition(const uint8_t uid[8], int8_t position) {
 
 // Get sensor UID assigned to a display position
 bool getSensorAtPosition(int8_t position, uint8_t uid[8]) {
+  SensorBusLock busLock;
   for (const auto& mapping : sensorMappings) {
     if (mapping.displayPosition == position && mapping.enabled) {
       memcpy(uid, mapping.uid, 8);
@@ -41,8 +41,30 @@ void sampleSensorsNonBlocking();
 // Process averaged ADC readings
 void processAdcReadings();
 
+// ========== Bus Locking ==========
+// The OneWire bus and sensorMappings are used from loop() (core 1) and from
+// the web handlers (network task, core 0). Hold the lock around either.
+// Recursive, so the helpers below can be called with it already held.
+#define SENSOR_BUS_WAIT_FOREVER 0xFFFFFFFFUL
+
+bool lockSensorBus(uint32_t waitMs = SENSOR_BUS_WAIT_FOREVER);
+void unlockSensorBus();
+
+// Scoped lock - check locked() when constructed with a finite wait
+class SensorBusLock {
+public:
+    explicit SensorBusLock(uint32_t waitMs = SENSOR_BUS_WAIT_FOREVER) : _locked(lockSensorBus(waitMs)) {}
+    ~SensorBusLock() { if (_locked) unlockSensorBus(); }
+    bool locked() const { return _locked; }
+
+private:
+    SensorBusLock(const SensorBusLock&);
+    SensorBusLock& operator=(const SensorBusLock&);
+    bool _locked;
+};
+
 // ========== Sensor Management Functions ==========
-// Initialize DS18B20 sensors
+// Initialize DS18B20 sensors (also creates the bus lock - call before the network task starts)
 void initDS18B20Sensors();
 
 // Load sensor configuration from SD card
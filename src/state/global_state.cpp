@@ -26,20 +26,28 @@ SensorState sensors = {
     .adcReady = false,
     .tachCounter = 0,
     .fanRPM = 0,
-    .fanSpeed = 0
+    .fanSpeed = 0,
+    .tempVersion = 0,
+    .readingVersion = 0
 };
 
 // ========== TEMPERATURE HISTORY ==========
 HistoryState history = {
     .tempHistory = nullptr,
     .historySize = 0,
-    .historyIndex = 0
+    .historyIndex = 0,
+    .sampleCount = 0,
+    .resizePending = false
 };
 
 // ========== FLUIDNC STATE ==========
 FluidNCState fluidnc = {
-    .machineState = "OFFLINE",
+    .machineState = MACHINE_OFFLINE,
+    .machineSubstate = -1,
+    .stateText = "OFFLINE",
     .posX = 0, .posY = 0, .posZ = 0, .posA = 0,
+    .reportCount = 0,
+    .reportTime = 0,
     .wposX = 0, .wposY = 0, .wposZ = 0, .wposA = 0,
     .wcoX = 0, .wcoY = 0, .wcoZ = 0, .wcoA = 0,
     .feedRate = 0,
@@ -47,15 +55,121 @@ FluidNCState fluidnc = {
     .feedOverride = 100,
     .rapidOverride = 100,
     .spindleOverride = 100,
+    .plannerBlocks = 0,
+    .rxBufferBytes = 0,
+    .lineNumber = 0,
+    .pins = "",
+    .accessories = "",
+    .sdPercent = -1.0f,
+    .sdFilename = "",
     .connected = false,
     .connectionAttempted = false,
     .jobStartTime = 0,
     .isJobRunning = false,
     .autoReportingEnabled = false,
     .reportingSetupTime = 0,
-    .debugWebSocket = false
+    .debugWebSocket = false,
+    .stateVersion = 0,
+    .changeMask = 0,
+    .fieldVersion = {0}
 };
 
+static const char* const MACHINE_STATE_NAMES[MACHINE_STATE_COUNT] = {
+    "OFFLINE", "IDLE", "RUN", "HOLD", "JOG", "ALARM",
+    "DOOR", "CHECK", "HOME", "SLEEP", "UNKNOWN"
+};
+
+const char* machineStateName(MachineState state) {
+    if (state >= MACHINE_STATE_COUNT) state = MACHINE_UNKNOWN;
+    return MACHINE_STATE_NAMES[state];
+}
+
+void markFluidNCChanged(uint32_t mask) {
+    mask &= FNC_CHG_ALL;
+    if (mask == 0) return;
+
+    fluidnc.stateVersion++;
+    fluidnc.changeMask = mask;
+
+    // Display text is formatted here, once per state change, so readers on
+    // either core just copy it with the rest of the struct
+    if (mask & FNC_CHG_STATE) {
+        if (fluidnc.machineSubstate >= 0) {
+            snprintf(fluidnc.stateText, sizeof(fluidnc.stateText), "%s:%d",
+                     machineStateName(fluidnc.machineState), fluidnc.machineSubstate);
+        } else {
+            strlcpy(fluidnc.stateText, machineStateName(fluidnc.machineState),
+                    sizeof(fluidnc.stateText));
+        }
+    }
+
+    for (uint8_t i = 0; i < FNC_CHG_GROUPS; i++) {
+        if (mask & (1u << i)) {
+            fluidnc.fieldVersion[i] = fluidnc.stateVersion;
+        }
+    }
+}
+
+uint32_t fluidncChangesSince(const FluidNCState& state, uint32_t version) {
+    uint32_t mask = 0;
+    for (uint8_t i = 0; i < FNC_CHG_GROUPS; i++) {
+        if (state.fieldVersion[i] > version) {
+            mask |= (1u << i);
+        }
+    }
+    return mask;
+}
+
+uint32_t fluidncVersionOf(const FluidNCState& state, uint32_t mask) {
+    uint32_t version = 0;
+    for (uint8_t i = 0; i < FNC_CHG_GROUPS; i++) {
+        if ((mask & (1u << i)) && state.fieldVersion[i] > version) {
+            version = state.fieldVersion[i];
+        }
+    }
+    return version;
+}
+
+// ========== CROSS-CORE SNAPSHOTS ==========
+Seqlock<FluidNCState> fluidncSnapshot;
+Seqlock<SensorState> sensorsSnapshot;
+FluidNCState fluidncView;
+SensorState sensorsView;
+
+void publishFluidNCState() {
+    // Everything the UI shows goes through markFluidNCChanged(), so only a
+    // new stateVersion needs publishing - or a new report that changed
+    // nothing, which the motion estimator still needs to see
+    static uint32_t publishedVersion = 0;
+    static uint32_t publishedReports = 0;
+    if (fluidnc.stateVersion == publishedVersion &&
+        fluidnc.reportCount == publishedReports) return;
+
+    fluidncSnapshot.write(fluidnc);
+    publishedVersion = fluidnc.stateVersion;
+    publishedReports = fluidnc.reportCount;
+}
+
+void refreshFluidNCView() {
+    static uint32_t viewSequence = UINT32_MAX;
+    uint32_t seq = fluidncSnapshot.sequence();
+    if (seq == viewSequence) return;
+    fluidncSnapshot.read(fluidncView);
+    viewSequence = seq;
+}
+
+void publishSensorState() {
+    sensorsSnapshot.write(sensors);
+}
+
+void refreshSensorsView() {
+    static uint32_t viewSequence = UINT32_MAX;
+    uint32_t seq = sensorsSnapshot.sequence();
+    if (seq == viewSequence) return;
+    sensorsSnapshot.read(sensorsView);
+    viewSequence = seq;
+}
+
 // ========== NETWORK STATE ==========
 NetworkState network = {
     .inAPMode = false,
@@ -66,7 +180,6 @@ NetworkState network = {
 // ========== TIMING STATE ==========
 TimingState timing = {
     .lastTachRead = 0,
-    .lastDisplayUpdate = 0,
     .lastHistoryUpdate = 0,
     .lastStatusRequest = 0,
     .sessionStartTime = 0,
@@ -78,4 +191,10 @@ TimingState timing = {
 void initGlobalState() {
     // Any runtime initialization if needed
     currentMode = MODE_MONITOR;
+
+    // Seed snapshots and views so the first frame/request sees the initial values
+    fluidncSnapshot.write(fluidnc);
+    sensorsSnapshot.write(sensors);
+    refreshFluidNCView();
+    refreshSensorsView();
 }
@@ -9,6 +9,7 @@
 #include <RTClib.h>
 #include "storage_manager.h"
 #include "../config/config.h"
+#include "../utils/seqlock.h"
 
 // ========== HARDWARE INSTANCES ==========
 extern StorageManager storage;
@@ -40,6 +41,10 @@ struct SensorState {
     volatile uint16_t tachCounter;
     uint16_t fanRPM;
     uint8_t fanSpeed;
+
+    // Change counters for the display
+    uint32_t tempVersion;       // A DS18B20 reading landed
+    uint32_t readingVersion;    // PSU / fan values were updated
 };
 extern SensorState sensors;
 
@@ -48,13 +53,56 @@ struct HistoryState {
     float *tempHistory;
     uint16_t historySize;
     uint16_t historyIndex;
+    uint32_t sampleCount;           // Samples added since allocation (graph scrolling)
+    volatile bool resizePending;    // Set by the web task, reallocated on the UI core
 };
 extern HistoryState history;
 
 // ========== FLUIDNC STATE ==========
+// Machine state as reported in the first field of a status report.
+// Hold and Door carry a reason code ("Hold:0", "Door:1") in machineSubstate.
+enum MachineState : uint8_t {
+    MACHINE_OFFLINE = 0,    // Not connected to FluidNC
+    MACHINE_IDLE,
+    MACHINE_RUN,
+    MACHINE_HOLD,
+    MACHINE_JOG,
+    MACHINE_ALARM,
+    MACHINE_DOOR,
+    MACHINE_CHECK,
+    MACHINE_HOME,
+    MACHINE_SLEEP,
+    MACHINE_UNKNOWN,        // Reported but not recognised
+    MACHINE_STATE_COUNT
+};
+
+// Change groups published by the status parser. Consumers compare
+// fieldVersion[] against the stateVersion they last rendered/logged and
+// only touch what actually moved.
+enum FluidNCChange : uint32_t {
+    FNC_CHG_STATE      = 1u << 0,   // machineState / job tracking
+    FNC_CHG_MPOS       = 1u << 1,
+    FNC_CHG_WPOS       = 1u << 2,
+    FNC_CHG_WCO        = 1u << 3,
+    FNC_CHG_FEED       = 1u << 4,   // feedRate, spindleRPM
+    FNC_CHG_OVERRIDES  = 1u << 5,
+    FNC_CHG_BUFFER     = 1u << 6,
+    FNC_CHG_LINE       = 1u << 7,
+    FNC_CHG_PINS       = 1u << 8,
+    FNC_CHG_ACCESSORY  = 1u << 9,
+    FNC_CHG_SD         = 1u << 10,
+    FNC_CHG_CONNECTION = 1u << 11,  // connected / disconnected
+    FNC_CHG_GROUPS     = 12,
+    FNC_CHG_ALL        = (1u << 12) - 1
+};
+
 struct FluidNCState {
-    String machineState;
+    MachineState machineState;
+    int8_t machineSubstate;     // Hold/Door reason code (-1 = none)
+    char stateText[16];         // "IDLE", "HOLD:0" - refreshed on FNC_CHG_STATE
     float posX, posY, posZ, posA;
+    uint32_t reportCount;       // Status reports parsed (changed or not)
+    unsigned long reportTime;   // millis() of the last one
     float wposX, wposY, wposZ, wposA;
     float wcoX, wcoY, wcoZ, wcoA;
     int feedRate;
@@ -62,6 +110,13 @@ struct FluidNCState {
     int feedOverride;
     int rapidOverride;
     int spindleOverride;
+    int plannerBlocks;          // Bf: free planner blocks
+    int rxBufferBytes;          // Bf: free serial RX bytes
+    int32_t lineNumber;         // Ln: current G-code line
+    char pins[12];              // Pn: active input pins ("" = none)
+    char accessories[8];        // A: spindle/coolant state ("" = off)
+    float sdPercent;            // SD: job progress (-1 = no SD job)
+    char sdFilename[48];        // SD: file being run
     bool connected;
     bool connectionAttempted;
     unsigned long jobStartTime;
@@ -69,9 +124,40 @@ struct FluidNCState {
     bool autoReportingEnabled;
     unsigned long reportingSetupTime;
     bool debugWebSocket;
+    uint32_t stateVersion;                  // Bumped once per change set
+    uint32_t changeMask;                    // FNC_CHG_* of the last change set
+    uint32_t fieldVersion[FNC_CHG_GROUPS];  // stateVersion when each group last changed
 };
 extern FluidNCState fluidnc;
 
+// Upper-case name of a machine state ("IDLE", "RUN", ...)
+const char* machineStateName(MachineState state);
+
+// Publish a set of FNC_CHG_* groups as one new stateVersion (no-op for 0)
+void markFluidNCChanged(uint32_t mask);
+
+// FNC_CHG_* groups of a state copy that changed after the given stateVersion
+uint32_t fluidncChangesSince(const FluidNCState& state, uint32_t version);
+
+// Latest stateVersion at which any of the FNC_CHG_* groups in mask changed
+uint32_t fluidncVersionOf(const FluidNCState& state, uint32_t mask);
+
+// ========== CROSS-CORE SNAPSHOTS ==========
+// The network task (core 0) owns `fluidnc`; loop() (core 1) owns `sensors`.
+// Each owner publishes into a seqlock and the other core works from a
+// private view refreshed once per iteration, so neither side ever blocks:
+//   core 1 (display, logger): read fluidncView
+//   core 0 (web handlers):    read sensorsView
+extern Seqlock<FluidNCState> fluidncSnapshot;
+extern Seqlock<SensorState> sensorsSnapshot;
+extern FluidNCState fluidncView;
+extern SensorState sensorsView;
+
+void publishFluidNCState();     // core 0, after the WebSocket loop
+void refreshFluidNCView();      // core 1, start of loop()
+void publishSensorState();      // core 1, after sensor processing
+void refreshSensorsView();      // core 0, before handling HTTP clients
+
 // ========== NETWORK STATE ==========
 struct NetworkState {
     bool inAPMode;
@@ -83,7 +169,6 @@ extern NetworkState network;
 // ========== TIMING STATE ==========
 struct TimingState {
     unsigned long lastTachRead;
-    unsigned long lastDisplayUpdate;
     unsigned long lastHistoryUpdate;
     unsigned long lastStatusRequest;
     unsigned long sessionStartTime;
@@ -106,6 +106,22 @@ String StorageManager::loadFile(const char* path) {
     return "";
 }
 
+File StorageManager::openFile(const char* path) {
+    // Same priority as loadFile(), without reading the content into RAM
+    if (sdAvailable && fileExists(SD, path)) {
+        Serial.printf("[StorageMgr] Opening %s from SD\n", path);
+        return SD.open(path, "r");
+    }
+
+    if (spiffsAvailable && fileExists(LittleFS, path)) {
+        Serial.printf("[StorageMgr] Opening %s from SPIFFS\n", path);
+        return LittleFS.open(path, "r");
+    }
+
+    Serial.printf("[StorageMgr] File not found: %s\n", path);
+    return File();
+}
+
 bool StorageManager::saveFile(const char* path, const String& content) {
     // Always save to SPIFFS (reliable)
     // Later can be synced to SD if available
@@ -26,6 +26,7 @@ public:
 
     // High-level file operations (auto-selects storage)
     String loadFile(const char* path);
+    File openFile(const char* path);    // For streaming reads; false if not found
     bool saveFile(const char* path, const String& content);
     bool exists(const char* path);
     bool remove(const char* path);
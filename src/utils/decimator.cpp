@@ -0,0 +1,121 @@
+#include "decimator.h"
+
+// ========== Incremental Envelopes ==========
+
+bool EnvelopeDecimator::begin(uint16_t columns, uint16_t window, uint32_t first) {
+    if (columns == 0 || columns > _capacity || window == 0) {
+        return false;
+    }
+    _columns = columns;
+    _window = window;
+    _next = first;
+    _empty = true;
+    return true;
+}
+
+void EnvelopeDecimator::add(float value) {
+    uint32_t col = columnOf(_next);
+
+    if (!_empty && col == lastColumn()) {
+        // Same column - widen it
+        Envelope& e = _env[col % _columns];
+        if (value < e.min) e.min = value;
+        if (value > e.max) e.max = value;
+        e.last = value;
+    } else {
+        // New column(s). With fewer samples than columns one sample covers
+        // several; the ring slots being reused belong to columns that have
+        // scrolled out of the window. The first sample also fills the
+        // columns left of it, back to firstColumn(), which no sample maps to.
+        uint32_t from = lastColumn() + 1;
+        if (_empty) {
+            from = (col >= (uint32_t)(_columns - 1)) ? col - (_columns - 1) : 0;
+        }
+        for (uint32_t c = from; c <= col; c++) {
+            Envelope& e = _env[c % _columns];
+            e.min = value;
+            e.max = value;
+            e.last = value;
+        }
+    }
+    _next++;
+    _empty = false;
+}
+
+// ========== One-shot Passes ==========
+
+void decimateMinMax(const float* ring, uint16_t size, uint16_t oldest,
+                    uint16_t buckets, float* min, float* max) {
+    for (uint16_t b = 0; b < buckets; b++) {
+        min[b] = NAN;
+        max[b] = NAN;
+    }
+
+    uint16_t idx = oldest;
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t b = (uint32_t)i * buckets / size;
+        float v = ring[idx];
+        if (isnan(min[b]) || v < min[b]) min[b] = v;
+        if (isnan(max[b]) || v > max[b]) max[b] = v;
+        if (++idx == size) idx = 0;
+    }
+}
+
+void decimateLTTB(const float* ring, uint16_t size, uint16_t oldest,
+                  uint16_t points, uint16_t* indices) {
+    #define LTTB_VALUE(i) ring[((uint32_t)oldest + (i)) % size]
+
+    if (points >= size || points < 3) {
+        // Nothing to drop (or too few points for buckets) - evenly spaced
+        uint16_t n = min(points, size);
+        for (uint16_t i = 0; i < n; i++) {
+            indices[i] = (n > 1) ? (uint32_t)i * (size - 1) / (n - 1) : 0;
+        }
+        return;
+    }
+
+    // First and last are kept; the rest of the series is split into
+    // points - 2 buckets and each picks the sample forming the largest
+    // triangle with the previous pick and the next bucket's average.
+    float bucketSize = (float)(size - 2) / (points - 2);
+    uint16_t a = 0;
+    indices[0] = 0;
+
+    for (uint16_t i = 0; i < points - 2; i++) {
+        uint16_t nextStart = (uint16_t)((i + 1) * bucketSize) + 1;
+        uint16_t nextEnd = min((uint16_t)((i + 2) * bucketSize + 1), size);
+        float avgX = 0;
+        float avgY = 0;
+        for (uint16_t j = nextStart; j < nextEnd; j++) {
+            avgX += j;
+            avgY += LTTB_VALUE(j);
+        }
+        uint16_t count = nextEnd - nextStart;
+        if (count > 0) {
+            avgX /= count;
+            avgY /= count;
+        } else {
+            avgX = size - 1;
+            avgY = LTTB_VALUE(size - 1);
+        }
+
+        uint16_t start = (uint16_t)(i * bucketSize) + 1;
+        uint16_t end = min((uint16_t)((i + 1) * bucketSize + 1), (uint16_t)(size - 1));
+        float ay = LTTB_VALUE(a);
+        float maxArea = -1;
+        uint16_t pick = start;
+        for (uint16_t j = start; j < end; j++) {
+            float area = fabsf((a - avgX) * (LTTB_VALUE(j) - ay) -
+                               (a - j) * (avgY - ay));
+            if (area > maxArea) {
+                maxArea = area;
+                pick = j;
+            }
+        }
+        indices[i + 1] = pick;
+        a = pick;
+    }
+    indices[points - 1] = size - 1;
+
+    #undef LTTB_VALUE
+}
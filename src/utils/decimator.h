@@ -0,0 +1,67 @@
+#ifndef DECIMATOR_H
+#define DECIMATOR_H
+
+#include <Arduino.h>
+
+// ========== History Decimation ==========
+// Reduces the temperature history to one envelope per output column, so a
+// plot costs O(width) instead of O(samples) and a one-sample spike always
+// survives as a column's max.
+//
+// EnvelopeDecimator keeps the envelopes of a scrolling plot up to date as
+// samples arrive. decimateMinMax() and decimateLTTB() are one-shot passes
+// over the history ring for the web API.
+
+struct Envelope {
+    float min;
+    float max;
+    float last;     // Newest sample in the column - joins it to the next one
+};
+
+class EnvelopeDecimator {
+public:
+    // storage holds `capacity` envelopes and is used as a ring
+    EnvelopeDecimator(Envelope* storage, uint16_t capacity)
+        : _env(storage), _capacity(capacity), _columns(0), _window(1),
+          _next(0), _empty(true) {}
+
+    // Map `window` samples onto `columns` columns. Samples are numbered by
+    // the caller; the first add() must be sample `first`.
+    bool begin(uint16_t columns, uint16_t window, uint32_t first);
+
+    // Fold in the next sample (numbered first, first + 1, ...)
+    void add(float value);
+
+    // Absolute column numbers - the newest sample is always in lastColumn()
+    uint32_t lastColumn() const { return columnOf(_next - 1); }
+    uint32_t firstColumn() const { return lastColumn() - (_columns - 1); }
+    const Envelope& at(uint32_t column) const { return _env[column % _columns]; }
+
+    uint32_t nextSample() const { return _next; }
+    uint16_t columns() const { return _columns; }
+
+private:
+    uint32_t columnOf(uint32_t sample) const {
+        return (uint64_t)sample * _columns / _window;
+    }
+
+    Envelope* _env;
+    uint16_t _capacity;
+    uint16_t _columns;
+    uint16_t _window;
+    uint32_t _next;         // Number of the next sample
+    bool _empty;
+};
+
+// Min/max of each of `buckets` equal slices of a ring buffer (oldest at
+// ring[oldest]). min and max receive `buckets` values each.
+void decimateMinMax(const float* ring, uint16_t size, uint16_t oldest,
+                    uint16_t buckets, float* min, float* max);
+
+// Largest-Triangle-Three-Buckets: picks `points` samples that keep the
+// visual shape of the series. indices receives sample positions (0 =
+// oldest), always including the first and last sample.
+void decimateLTTB(const float* ring, uint16_t size, uint16_t oldest,
+                  uint16_t points, uint16_t* indices);
+
+#endif // DECIMATOR_H
@@ -0,0 +1,67 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+// ========== Sequence Lock ==========
+// Single-writer snapshot for plain-data structs shared between the two cores.
+// The writer never waits; a reader copies the struct and retries if a write
+// overlapped the copy (odd sequence, or sequence changed while copying).
+//
+// Uses only std::atomic/std::thread so the same header builds on the ESP32
+// and on a host with std::thread for exercising it off-target.
+//
+// T must be plain data (no String/pointers owning memory) - it is copied
+// byte-wise.
+
+template <typename T>
+class Seqlock {
+public:
+    Seqlock() : _seq(0) {
+        memset(&_data, 0, sizeof(_data));
+    }
+
+    // Publish a new value. Only one thread may write.
+    void write(const T& value) {
+        uint32_t seq = _seq.load(std::memory_order_relaxed);
+        _seq.store(seq + 1, std::memory_order_relaxed);     // Odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&_data, &value, sizeof(T));
+        _seq.store(seq + 2, std::memory_order_release);     // Even: stable
+    }
+
+    // Single copy attempt; false if it overlapped a write
+    bool tryRead(T& out) const {
+        uint32_t before = _seq.load(std::memory_order_acquire);
+        if (before & 1) return false;
+        memcpy(&out, &_data, sizeof(T));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return _seq.load(std::memory_order_relaxed) == before;
+    }
+
+    // Copy a consistent snapshot, retrying until no write overlaps
+    void read(T& out) const {
+        uint8_t attempts = 0;
+        while (!tryRead(out)) {
+            // Let a preempted writer on this core finish
+            if (++attempts >= 4) {
+                std::this_thread::yield();
+                attempts = 0;
+            }
+        }
+    }
+
+    // Even and bumped by every write - cheap "has anything changed" check
+    uint32_t sequence() const {
+        return _seq.load(std::memory_order_acquire);
+    }
+
+private:
+    std::atomic<uint32_t> _seq;
+    T _data;
+};
+
+#endif // SEQLOCK_H
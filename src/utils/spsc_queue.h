@@ -0,0 +1,59 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstdint>
+
+// ========== Single-Producer / Single-Consumer Queue ==========
+// Lock-free ring for handing small plain-data items from an interrupt
+// handler to loop(). Exactly one context may push and one may pop; neither
+// ever blocks. A push into a full queue drops the item and counts it.
+//
+// push() is forced inline so it ends up inside the (IRAM) ISR that calls
+// it. Like seqlock.h this uses only std::atomic, so it builds on a host.
+//
+// N must be a power of two; the queue holds N - 1 items.
+
+template <typename T, uint8_t N>
+class SpscQueue {
+    static_assert((N & (N - 1)) == 0 && N >= 2, "N must be a power of two");
+
+public:
+    SpscQueue() : _head(0), _tail(0), _dropped(0) {}
+
+    // Producer side
+    __attribute__((always_inline)) inline bool push(const T& item) {
+        uint8_t head = _head.load(std::memory_order_relaxed);
+        uint8_t next = (head + 1) & (N - 1);
+        if (next == _tail.load(std::memory_order_acquire)) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        _items[head] = item;
+        _head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T& item) {
+        uint8_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = _items[tail];
+        _tail.store((tail + 1) & (N - 1), std::memory_order_release);
+        return true;
+    }
+
+    uint32_t dropped() const {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    T _items[N];
+    std::atomic<uint8_t> _head;     // Next slot to write
+    std::atomic<uint8_t> _tail;     // Next slot to read
+    std::atomic<uint32_t> _dropped;
+};
+
+#endif // SPSC_QUEUE_H
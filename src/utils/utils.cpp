@@ -1,10 +1,30 @@
 #include "utils.h"
 #include "config/config.h"
 #include "state/global_state.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+static SemaphoreHandle_t historyMutex = nullptr;
 
 // ========== Memory Management ==========
 
+void lockHistory() {
+  if (historyMutex == nullptr) return;  // Before the first allocation - single task
+  xSemaphoreTake(historyMutex, portMAX_DELAY);
+}
+
+void unlockHistory() {
+  if (historyMutex == nullptr) return;
+  xSemaphoreGive(historyMutex);
+}
+
 void allocateHistoryBuffer() {
+  // First call is from setup(), before the network task exists
+  if (historyMutex == nullptr) {
+    historyMutex = xSemaphoreCreateMutex();
+  }
+  HistoryLock lock;
+
   // Calculate required buffer size with safety limit
   history.historySize = cfg.graph_timespan_seconds / cfg.graph_update_interval;
 
@@ -36,6 +56,7 @@ void allocateHistoryBuffer() {
   }
 
   history.historyIndex = 0;
+  history.sampleCount = 0;
 
   Serial.printf("History buffer: %d points (%d seconds, %d bytes)\n",
                 history.historySize, cfg.graph_timespan_seconds, history.historySize * sizeof(float));
@@ -7,6 +7,21 @@
 // Allocate temperature history buffer based on config
 void allocateHistoryBuffer();
 
+// Held while the buffer is reallocated; web handlers (core 0) take it to
+// read the history the UI loop owns
+void lockHistory();
+void unlockHistory();
+
+class HistoryLock {
+public:
+    HistoryLock() { lockHistory(); }
+    ~HistoryLock() { unlockHistory(); }
+
+private:
+    HistoryLock(const HistoryLock&);
+    HistoryLock& operator=(const HistoryLock&);
+};
+
 // ========== Watchdog Functions ==========
 // Note: enableLoopWDT() and feedLoopWDT() are provided by the ESP32 Arduino framework
 // They are declared in esp32-hal.h and don't need to be redeclared here
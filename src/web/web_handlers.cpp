@@ -1,10 +1,22 @@
 #include "web_handlers.h"
 #include "state/global_state.h"
 #include "display/display.h"
+#include "display/screen_renderer.h"
+#include "display/region_compositor.h"
+#include "display/render_profiler.h"
+#include "display/render_scheduler.h"
+#include "display/chrome_cache.h"
+#include "display/screen_snapshot.h"
 #include "config/config.h"
 #include "sensors/sensors.h"
 #include "network/network.h"
+#include "network/link_stats.h"
+#include "network/poll_scheduler.h"
+#include "network/status_parser.h"
+#include "network/tcp_transport.h"
+#include "network/uart_transport.h"
 #include "utils/utils.h"
+#include "utils/decimator.h"
 #include "web/web_utils.h"
 #include "storage_manager.h"
 #include "logging/data_logger.h"
@@ -102,7 +114,7 @@ void handleAPISave() {
     uint16_t newTime = server.arg("graph_time").toInt();
     if (newTime != cfg.graph_timespan_seconds) {
       cfg.graph_timespan_seconds = newTime;
-      allocateHistoryBuffer(); // Reallocate with new size
+      history.resizePending = true;  // Reallocated by loop() - the graph reads it on core 1
     }
   }
   if (server.hasArg("graph_interval")) {
@@ -117,6 +129,9 @@ void handleAPISave() {
   if (server.hasArg("coord_decimals")) {
     cfg.coord_decimal_places = server.arg("coord_decimals").toInt();
   }
+  if (server.hasArg("show_link_stats")) {
+    cfg.show_link_stats = (server.arg("show_link_stats").toInt() == 1);
+  }
   if (server.hasArg("use_fahrenheit")) {
     int value = server.arg("use_fahrenheit").toInt();
     cfg.use_fahrenheit = (value == 1);
@@ -137,21 +152,52 @@ void handleAPISave() {
     cfg.fluidnc_port = server.arg("fluidnc_port").toInt();
   }
 
+  uint8_t oldTransport = cfg.fluidnc_transport;
+  if (server.hasArg("fluidnc_transport")) {
+    int transport = server.arg("fluidnc_transport").toInt();
+    cfg.fluidnc_transport = (transport == TRANSPORT_TCP || transport == TRANSPORT_UART) ? transport : TRANSPORT_WEBSOCKET;
+  }
+  if (server.hasArg("fluidnc_tcp_port")) {
+    cfg.fluidnc_tcp_port = constrain(server.arg("fluidnc_tcp_port").toInt(), 1, 65535);
+  }
+  if (server.hasArg("fluidnc_baud")) {
+    cfg.fluidnc_baud = constrain(server.arg("fluidnc_baud").toInt(), 9600, 2000000);
+  }
+
+  // Status polling (fast rate while moving, slow rate while idle)
+  if (server.hasArg("status_rate")) {
+    cfg.status_update_rate = constrain(server.arg("status_rate").toInt(), 50, 5000);
+  }
+  if (server.hasArg("status_idle_rate")) {
+    cfg.status_idle_rate = constrain(server.arg("status_idle_rate").toInt(), 100, 30000);
+  }
+  if (server.hasArg("fluidnc_auto_report")) {
+    cfg.fluidnc_auto_report = (server.arg("fluidnc_auto_report").toInt() == 1);
+  }
+
   saveConfig();
 
   // If FluidNC was just enabled, connect immediately
-  if (!fluidncWasEnabled && fluidncNowEnabled && WiFi.status() == WL_CONNECTED) {
+  if (!fluidncWasEnabled && fluidncNowEnabled &&
+      (WiFi.status() == WL_CONNECTED || cfg.fluidnc_transport == TRANSPORT_UART)) {
     Serial.println("[FluidNC] Enabled via settings - connecting...");
     connectFluidNC();
     fluidnc.connectionAttempted = true;
   }
+  // Transport switched while enabled - reconnect over the new one
+  else if (fluidncNowEnabled && cfg.fluidnc_transport != oldTransport && fluidnc.connectionAttempted) {
+    Serial.println("[FluidNC] Transport changed - reconnecting...");
+    connectFluidNC();
+  }
   // If FluidNC was disabled, disconnect
   else if (fluidncWasEnabled && !fluidncNowEnabled) {
     Serial.println("[FluidNC] Disabled via settings - disconnecting...");
-    webSocket.disconnect();
+    disconnectFluidNC();
     fluidnc.connectionAttempted = false;
     fluidnc.connected = false;
-    fluidnc.machineState = "OFFLINE";
+    fluidnc.machineState = MACHINE_OFFLINE;
+    fluidnc.machineSubstate = -1;
+    markFluidNCChanged(FNC_CHG_CONNECTION | FNC_CHG_STATE);
   }
 
   server.send(200, "text/plain", "Settings saved successfully");
@@ -322,6 +368,7 @@ void handleAPISensorsList() {
   JsonDocument doc;
   JsonArray sensors = doc["sensors"].to<JsonArray>();
 
+  SensorBusLock busLock;  // sensorMappings is read by the display on core 1
   for (const SensorMapping& mapping : sensorMappings) {
     JsonObject sensor = sensors.add<JsonObject>();
     sensor["uid"] = uidToString(mapping.uid);
@@ -377,6 +424,7 @@ void handleAPISensorsSave() {
 
   // Update notes if provided
   if (success && notes.length() > 0) {
+    SensorBusLock busLock;
     for (auto& mapping : sensorMappings) {
       if (memcmp(mapping.uid, uid, 8) == 0) {
         strlcpy(mapping.notes, notes.c_str(), sizeof(mapping.notes));
@@ -399,6 +447,8 @@ void handleAPISensorsTemps() {
   JsonDocument doc;
   JsonArray sensors = doc["sensors"].to<JsonArray>();
 
+  SensorBusLock busLock;
+
   // Return temps for configured sensors
   for (const SensorMapping& mapping : sensorMappings) {
     if (mapping.enabled) {
@@ -433,6 +483,65 @@ void handleAPISensorsTemps() {
   server.send(200, "application/json", response);
 }
 
+// GET /api/history - Temperature history decimated for plotting
+// ?points=N (default 200, max 500)
+// &mode=minmax - min/max per bucket, keeps every spike (default)
+// &mode=lttb   - N representative samples (Largest-Triangle-Three-Buckets)
+// Times are seconds relative to the newest sample; temperatures are C.
+void handleAPIHistory() {
+  uint16_t points = 200;
+  if (server.hasArg("points")) {
+    points = constrain(server.arg("points").toInt(), 2, 500);
+  }
+  bool lttb = server.hasArg("mode") && server.arg("mode") == "lttb";
+
+  JsonDocument doc;
+  doc["mode"] = lttb ? "lttb" : "minmax";
+  doc["interval_s"] = cfg.graph_update_interval;
+
+  {
+    // The UI loop may reallocate the buffer when the timespan changes
+    HistoryLock lock;
+    uint16_t size = history.historySize;
+    if (history.tempHistory == nullptr || size == 0) {
+      server.send(503, "application/json", "{\"error\":\"History not allocated\"}");
+      return;
+    }
+    uint16_t oldest = history.historyIndex;
+    doc["samples"] = size;
+
+    if (lttb) {
+      points = min(points, size);
+      std::vector<uint16_t> indices(points);
+      decimateLTTB(history.tempHistory, size, oldest, points, indices.data());
+
+      JsonArray t = doc["t"].to<JsonArray>();
+      JsonArray temp = doc["temp"].to<JsonArray>();
+      for (uint16_t i = 0; i < points; i++) {
+        t.add(((int32_t)indices[i] - (size - 1)) * (int32_t)cfg.graph_update_interval);
+        temp.add(history.tempHistory[(oldest + indices[i]) % size]);
+      }
+    } else {
+      points = min(points, size);
+      std::vector<float> lo(points);
+      std::vector<float> hi(points);
+      decimateMinMax(history.tempHistory, size, oldest, points, lo.data(), hi.data());
+
+      doc["bucket_s"] = (float)size * cfg.graph_update_interval / points;
+      JsonArray minArr = doc["min"].to<JsonArray>();
+      JsonArray maxArr = doc["max"].to<JsonArray>();
+      for (uint16_t i = 0; i < points; i++) {
+        minArr.add(lo[i]);
+        maxArr.add(hi[i]);
+      }
+    }
+  }
+
+  String response;
+  serializeJson(doc, response);
+  server.send(200, "application/json", response);
+}
+
 // POST /api/sensors/detect - Start touch detection to identify which sensor is being touched
 // Body: {"timeout": 30000} (optional, default 30 seconds)
 // Returns: {"uid": "28FF641E8C160450"} or {"uid": ""} on timeout
@@ -469,6 +578,7 @@ void handleAPIDriversGet() {
 
   const char* positionNames[] = {"X-Axis", "Y-Left", "Y-Right", "Z-Axis"};
 
+  SensorBusLock busLock;
   for (int pos = 0; pos < 4; pos++) {
     JsonObject driver = drivers.add<JsonObject>();
     driver["position"] = pos;
@@ -557,6 +667,7 @@ void handleAPIDriversClear() {
   }
 
   // Clear position assignment
+  SensorBusLock busLock;
   for (auto& mapping : sensorMappings) {
     if (mapping.displayPosition == position) {
       mapping.displayPosition = -1;
@@ -691,6 +802,187 @@ void handleAPILogsClear() {
   server.send(success ? 200 : 500, "application/json", output);
 }
 
+// ========== Performance API ==========
+
+static void addHistogram(JsonObject parent, const char* name, const uint32_t* counts) {
+  JsonArray buckets = parent[name].to<JsonArray>();
+  for (int i = 0; i < LINK_HIST_BUCKETS; i++) {
+    JsonObject bucket = buckets.add<JsonObject>();
+    if (i < LINK_HIST_BUCKETS - 1) {
+      bucket["lt_ms"] = LINK_HIST_LIMITS[i];
+    } else {
+      bucket["lt_ms"] = nullptr;  // Open-ended last bucket
+    }
+    bucket["count"] = counts[i];
+  }
+}
+
+// GET /api/perf/fluidnc - FluidNC link latency and throughput
+// Optional ?reset=1 clears the counters after reporting them
+void handleAPIPerfFluidNC() {
+  updateLinkRates();
+
+  JsonDocument doc;
+  doc["connected"] = fluidnc.connected;
+  doc["link"] = fluidncLinkStateName();
+  doc["transport"] = fluidncTransportName();
+  doc["poll_interval_ms"] = currentPollInterval();
+  doc["auto_reporting"] = fluidnc.autoReportingEnabled;
+
+  JsonObject polls = doc["polls"].to<JsonObject>();
+  polls["sent"] = linkStats.pollsSent;
+  polls["answered"] = linkStats.pollsAnswered;
+  polls["unanswered"] = linkStats.pollsUnanswered;
+  polls["unsolicited_reports"] = linkStats.unsolicitedReports;
+
+  JsonObject rtt = doc["rtt"].to<JsonObject>();
+  rtt["last_us"] = linkStats.rttLastUs;
+  rtt["min_us"] = linkStats.rttMinUs;
+  rtt["max_us"] = linkStats.rttMaxUs;
+  rtt["avg_us"] = linkStats.rttAvgUs;
+  rtt["jitter_us"] = linkStats.jitterUs;
+  addHistogram(rtt, "histogram", linkStats.rttHist);
+  addHistogram(rtt, "jitter_histogram", linkStats.jitterHist);
+
+  JsonObject traffic = doc["traffic"].to<JsonObject>();
+  traffic["messages"] = linkStats.messages;
+  traffic["bytes"] = linkStats.bytes;
+  traffic["messages_per_sec"] = linkStats.messagesPerSec;
+  traffic["bytes_per_sec"] = linkStats.bytesPerSec;
+
+  JsonObject parse = doc["parse"].to<JsonObject>();
+  parse["reports"] = linkStats.reportsParsed;
+  parse["last_us"] = linkStats.parseLastUs;
+  parse["max_us"] = linkStats.parseMaxUs;
+  parse["avg_us"] = linkStats.parseAvgUs;
+  parse["malformed"] = parseStats.malformed;
+  parse["tcp_line_overflows"] = tcpTransport.lineOverflows();
+  parse["uart_line_overflows"] = uartTransport.lineOverflows();
+  parse["uart_framing_errors"] = uartTransport.framingErrors();
+  parse["uart_resyncs"] = uartTransport.resyncs();
+
+  if (server.hasArg("reset") && server.arg("reset") == "1") {
+    resetLinkStats();
+  }
+
+  String output;
+  serializeJson(doc, output);
+  server.send(200, "application/json", output);
+}
+
+static void addPerfWindow(JsonObject parent, const char* name, const PerfWindow& window) {
+  JsonObject timing = parent[name].to<JsonObject>();
+  timing["calls"] = window.calls;
+  timing["p50_us"] = perfPercentile(window, 50);
+  timing["p95_us"] = perfPercentile(window, 95);
+  timing["p99_us"] = perfPercentile(window, 99);
+  timing["max_us"] = window.maxUs;
+  timing["last_pixels"] = window.lastPixels;
+  timing["last_spi_bytes"] = window.lastPixels * 2;
+  timing["total_spi_bytes"] = window.totalPixels * 2;
+}
+
+// GET /api/perf/display - Pixels pushed by the retained layout renderer
+// and the DMA region compositor, and per-mode draw/update times
+// (written by the display loop on the other core; values are informational)
+void handleAPIPerfDisplay() {
+  JsonDocument doc;
+  doc["frames"] = renderStats.frames;
+  doc["elements_redrawn"] = renderStats.elementsRedrawn;
+  doc["pixels_last_frame"] = renderStats.pixelsLastFrame;
+  doc["pixels_full_redraw"] = renderStats.pixelsFullRedraw;
+  doc["draw_calls_last_frame"] = renderStats.drawCallsLastFrame;
+  doc["draw_calls_full_redraw"] = renderStats.drawCallsFullRedraw;
+  doc["pixels_sent_total"] = renderStats.pixelsSentTotal;
+  doc["pixels_saved_total"] = renderStats.pixelsSavedTotal;
+
+  JsonObject compositor = doc["compositor"].to<JsonObject>();
+  compositor["regions"] = compositorStats.regions;
+  compositor["fallbacks"] = compositorStats.fallbacks;
+  compositor["pixels"] = compositorStats.pixels;
+
+  JsonObject scheduler = doc["scheduler"].to<JsonObject>();
+  scheduler["passes"] = renderSchedulerStats.passes;
+  scheduler["fields_drawn"] = renderSchedulerStats.fieldsDrawn;
+  scheduler["deferred"] = renderSchedulerStats.deferred;
+  scheduler["budget_us"] = RENDER_BUDGET_US;
+
+  JsonObject chrome = doc["chrome_cache"].to<JsonObject>();
+  chrome["hits"] = chromeCacheStats.hits;
+  chrome["misses"] = chromeCacheStats.misses;
+  chrome["renders"] = chromeCacheStats.renders;
+  chrome["overflows"] = chromeCacheStats.overflows;
+  chrome["bytes"] = chromeCacheStats.bytes;
+
+  // Rolling window of the last PERF_WINDOW calls per mode
+  JsonObject modes = doc["modes"].to<JsonObject>();
+  for (uint8_t mode = 0; mode < PERF_MODES; mode++) {
+    if (renderProfile.modes[mode][PERF_DRAW].calls == 0 &&
+        renderProfile.modes[mode][PERF_UPDATE].calls == 0) {
+      continue;  // Never shown
+    }
+    JsonObject entry = modes[perfModeName(mode)].to<JsonObject>();
+    addPerfWindow(entry, "draw", renderProfile.modes[mode][PERF_DRAW]);
+    addPerfWindow(entry, "update", renderProfile.modes[mode][PERF_UPDATE]);
+  }
+
+  // JSON layout elements, in layout order
+  JsonArray elements = doc["elements"].to<JsonArray>();
+  for (uint8_t i = 0; i < renderProfile.elementCount; i++) {
+    JsonObject elem = elements.add<JsonObject>();
+    elem["last_us"] = renderProfile.elements[i].lastUs;
+    elem["max_us"] = renderProfile.elements[i].maxUs;
+    elem["draws"] = renderProfile.elements[i].draws;
+  }
+  doc["overlay"] = perfOverlayEnabled();
+
+  JsonObject snapshot = doc["snapshot"].to<JsonObject>();
+  snapshot["count"] = snapshotStats.count;
+  snapshot["last_render_us"] = snapshotStats.lastRenderUs;
+  snapshot["failures"] = snapshotStats.failures;
+
+  String output;
+  serializeJson(doc, output);
+  server.send(200, "application/json", output);
+}
+
+static void sendSnapshotBytes(const uint8_t* data, size_t length) {
+  server.sendContent((const char*)data, length);
+}
+
+// GET /api/snapshot?mode=monitor|alignment|graph|dro or ?layout=/screens/x.json
+// Off-screen render of a screen as a 16-bit BMP (see screen_snapshot.h)
+void handleAPISnapshot() {
+  String modeName = server.hasArg("mode") ? server.arg("mode") : String("monitor");
+  if (server.hasArg("layout") || modeName == perfModeName(MODE_DRO)) {
+    // The DRO mode is its layout - loaded here as a private copy
+    String path = server.hasArg("layout") ? server.arg("layout") : String(DRO_SCREEN_PATH);
+    ScreenLayout layout = {nullptr, nullptr, 0, 0, 0, 0, 0, false, false};
+    if (!loadScreenConfig(path.c_str(), layout)) {
+      sendJsonError(server, 404, "Layout not found", path.c_str());
+      return;
+    }
+    server.setContentLength(SNAPSHOT_BYTES);
+    server.send(200, "image/bmp", "");
+    snapshotLayout(layout, sendSnapshotBytes);
+    freeScreenLayout(layout);
+    return;
+  }
+
+  int mode = -1;
+  for (uint8_t i = 0; i < PERF_MODES; i++) {
+    if (modeName == perfModeName(i)) mode = i;
+  }
+  if (mode != MODE_MONITOR && mode != MODE_ALIGNMENT && mode != MODE_GRAPH) {
+    sendJsonError(server, 400, "Unsupported mode", "Use mode=monitor|alignment|graph|dro or layout=<path>");
+    return;
+  }
+
+  server.setContentLength(SNAPSHOT_BYTES);
+  server.send(200, "image/bmp", "");
+  snapshotMode((DisplayMode)mode, sendSnapshotBytes);
+}
+
 // ========== Web Server Setup ==========
 
 void setupWebServer() {
@@ -725,6 +1017,7 @@ void setupWebServer() {
   server.on("/api/sensors/list", HTTP_GET, handleAPISensorsList);
   server.on("/api/sensors/save", HTTP_POST, handleAPISensorsSave);
   server.on("/api/sensors/temps", HTTP_GET, handleAPISensorsTemps);
+  server.on("/api/history", HTTP_GET, handleAPIHistory);
   server.on("/api/sensors/detect", HTTP_POST, handleAPISensorsDetect);
 
   // Driver assignment API endpoints
@@ -739,6 +1032,11 @@ void setupWebServer() {
   server.on("/api/logs/download", HTTP_GET, handleAPILogsDownload);
   server.on("/api/logs/clear", HTTP_DELETE, handleAPILogsClear);
 
+  // Performance instrumentation
+  server.on("/api/perf/fluidnc", HTTP_GET, handleAPIPerfFluidNC);
+  server.on("/api/perf/display", HTTP_GET, handleAPIPerfDisplay);
+  server.on("/api/snapshot", HTTP_GET, handleAPISnapshot);
+
   // 404 handler
   server.onNotFound([]() {
     server.send(404, "text/plain", "404: Page not found");
@@ -815,6 +1113,11 @@ String getSettingsHTML() {
   html.replace("%FLUIDNC_ENABLED%", cfg.fluidnc_auto_discover ? "checked" : "");
   html.replace("%FLUIDNC_IP%", String(cfg.fluidnc_ip));
   html.replace("%FLUIDNC_PORT%", String(cfg.fluidnc_port));
+  html.replace("%FLUIDNC_TRANSPORT_WS%", cfg.fluidnc_transport == TRANSPORT_WEBSOCKET ? "selected" : "");
+  html.replace("%FLUIDNC_TRANSPORT_TCP%", cfg.fluidnc_transport == TRANSPORT_TCP ? "selected" : "");
+  html.replace("%FLUIDNC_TRANSPORT_UART%", cfg.fluidnc_transport == TRANSPORT_UART ? "selected" : "");
+  html.replace("%FLUIDNC_TCP_PORT%", String(cfg.fluidnc_tcp_port));
+  html.replace("%FLUIDNC_BAUD%", String(cfg.fluidnc_baud));
 
   return html;
 }
@@ -875,6 +1178,9 @@ String getConfigJSON() {
   doc["fluidnc_ip"] = cfg.fluidnc_ip;
   doc["fluidnc_port"] = cfg.fluidnc_port;
   doc["fluidnc_auto_discover"] = cfg.fluidnc_auto_discover;
+  doc["fluidnc_transport"] = cfg.fluidnc_transport;
+  doc["fluidnc_tcp_port"] = cfg.fluidnc_tcp_port;
+  doc["fluidnc_baud"] = cfg.fluidnc_baud;
 
   // Temperature settings
   doc["temp_threshold_low"] = cfg.temp_threshold_low;
@@ -899,6 +1205,7 @@ String getConfigJSON() {
   doc["show_machine_coords"] = cfg.show_machine_coords;
   doc["show_temp_graph"] = cfg.show_temp_graph;
   doc["coord_decimal_places"] = cfg.coord_decimal_places;
+  doc["show_link_stats"] = cfg.show_link_stats;
 
   // Graph settings
   doc["graph_timespan_seconds"] = cfg.graph_timespan_seconds;
@@ -911,6 +1218,8 @@ String getConfigJSON() {
   // System settings
   doc["enable_logging"] = cfg.enable_logging;
   doc["status_update_rate"] = cfg.status_update_rate;
+  doc["status_idle_rate"] = cfg.status_idle_rate;
+  doc["fluidnc_auto_report"] = cfg.fluidnc_auto_report;
 
   String output;
   serializeJson(doc, output);
@@ -929,7 +1238,7 @@ String getStatusJSON() {
   // Temperatures (convert based on user preference)
   JsonArray temps = doc["temperatures"].to<JsonArray>();
   for (int i = 0; i < 4; i++) {
-    float temp = sensors.temperatures[i];
+    float temp = sensorsView.temperatures[i];
     if (cfg.use_fahrenheit) {
       temp = (temp * 9.0 / 5.0) + 32.0;
     }
@@ -938,17 +1247,26 @@ String getStatusJSON() {
   doc["temp_unit"] = cfg.use_fahrenheit ? "F" : "C";
 
   // PSU
-  doc["psu_voltage"] = sensors.psuVoltage;
-  doc["psu_min"] = sensors.psuMin;
-  doc["psu_max"] = sensors.psuMax;
+  doc["psu_voltage"] = sensorsView.psuVoltage;
+  doc["psu_min"] = sensorsView.psuMin;
+  doc["psu_max"] = sensorsView.psuMax;
 
   // Fan
-  doc["fan_rpm"] = sensors.fanRPM;
-  doc["fan_speed"] = sensors.fanSpeed;
+  doc["fan_rpm"] = sensorsView.fanRPM;
+  doc["fan_speed"] = sensorsView.fanSpeed;
 
   // FluidNC status
   doc["fluidnc_connected"] = fluidnc.connected;
-  doc["machine_state"] = fluidnc.machineState;
+  doc["fluidnc_link"] = fluidncLinkStateName();
+  doc["fluidnc_transport"] = fluidncTransportName();
+  doc["machine_state"] = fluidnc.stateText;
+  doc["machine_substate"] = fluidnc.machineSubstate;
+
+  // Change tracking - clients pass ?since=<fluidnc_version> to learn which
+  // FNC_CHG_* groups moved since their last poll
+  doc["fluidnc_version"] = fluidnc.stateVersion;
+  uint32_t since = server.hasArg("since") ? (uint32_t)server.arg("since").toInt() : 0;
+  doc["fluidnc_changes"] = fluidncChangesSince(fluidnc, since);
 
   // Machine positions (work coordinates)
   JsonObject wpos = doc["wpos"].to<JsonObject>();
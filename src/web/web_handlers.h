@@ -28,6 +28,7 @@ void handleAPISensorsDiscover();
 void handleAPISensorsList();
 void handleAPISensorsSave();
 void handleAPISensorsTemps();
+void handleAPIHistory();
 void handleAPISensorsDetect();
 void handleAPIDriversGet();
 void handleAPIDriversAssign();
@@ -38,6 +39,10 @@ void handleAPILogsStatus();
 void handleAPILogsList();
 void handleAPILogsDownload();
 void handleAPILogsClear();
+// Performance API handlers
+void handleAPIPerfFluidNC();
+void handleAPIPerfDisplay();
+void handleAPISnapshot();
 
 // HTML generators
 String getMainHTML();
@@ -0,0 +1,83 @@
+#include "Arduino.h"
+
+// ========== Fake Clock ==========
+static unsigned long hostMillis = 0;
+
+unsigned long millis() { return hostMillis; }
+unsigned long micros() { return hostMillis * 1000UL; }
+void delay(unsigned long ms) { hostMillis += ms; }
+void yield() {}
+
+void hostSetMillis(unsigned long ms) { hostMillis = ms; }
+void hostAdvanceMillis(unsigned long ms) { hostMillis += ms; }
+
+// ========== GPIO ==========
+static int hostPins[64];
+static bool hostPinsSet[64];
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+
+int digitalRead(uint8_t pin) {
+    return (pin < 64 && hostPinsSet[pin]) ? hostPins[pin] : HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+    hostSetPin(pin, level);
+}
+
+void attachInterrupt(uint8_t pin, void (*handler)(), int mode) {}
+
+void hostSetPin(uint8_t pin, int level) {
+    if (pin >= 64) return;
+    hostPins[pin] = level;
+    hostPinsSet[pin] = true;
+}
+
+// ========== ESP ==========
+EspClass ESP;
+
+void EspClass::restart() {
+    fprintf(stderr, "ESP.restart() called\n");
+    exit(1);
+}
+
+// ========== Print ==========
+size_t Print::printf(const char* format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < 0) return 0;
+    return write(buffer, std::min((size_t)length, sizeof(buffer) - 1));
+}
+
+// ========== Stream ==========
+// Consume input until 'target' (true) or 'terminator' (false) has been read
+bool Stream::findUntil(const char* target, const char* terminator) {
+    size_t targetLen = strlen(target);
+    size_t termLen = terminator ? strlen(terminator) : 0;
+    std::string seen;
+    int c;
+    while ((c = read()) >= 0) {
+        seen += (char)c;
+        if (seen.size() >= targetLen && seen.compare(seen.size() - targetLen, targetLen, target) == 0) {
+            return true;
+        }
+        if (termLen && seen.size() >= termLen &&
+            seen.compare(seen.size() - termLen, termLen, terminator) == 0) {
+            return false;
+        }
+    }
+    return false;
+}
+
+// ========== Serial ==========
+HardwareSerial Serial(0);
+HardwareSerial Serial2(2);
+
+size_t HardwareSerial::write(uint8_t c) {
+    if (_uart != 0) return 1;  // Only the console goes anywhere
+    fputc(c, stdout);
+    return 1;
+}
@@ -0,0 +1,219 @@
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+// ========== Host Arduino Shim ==========
+// Just enough of the Arduino core for the firmware sources built by
+// [env:native] (platformio.ini) to compile and run on a PC. Time is a fake
+// clock the tests move by hand; Serial writes to stdout.
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <cstdarg>
+#include <algorithm>
+#include <string>
+
+using std::min;
+using std::max;
+using std::isnan;
+using std::isinf;
+
+#define IRAM_ATTR
+#define PROGMEM
+#define F(x) x
+
+typedef uint8_t byte;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// Not in every libc; renamed so it cannot clash with one that has it
+#define strlcpy hostStrlcpy
+inline size_t hostStrlcpy(char* dst, const char* src, size_t size) {
+    size_t length = strlen(src);
+    if (size > 0) {
+        size_t n = std::min(length, size - 1);
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return length;
+}
+
+// ========== String ==========
+class String {
+public:
+    String() {}
+    String(const char* text) : _s(text ? text : "") {}
+    String(const std::string& text) : _s(text) {}
+    String(char c) : _s(1, c) {}
+    String(int value) : _s(std::to_string(value)) {}
+    String(unsigned value) : _s(std::to_string(value)) {}
+    String(long value) : _s(std::to_string(value)) {}
+    String(unsigned long value) : _s(std::to_string(value)) {}
+    String(double value, unsigned digits = 2) {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%.*f", (int)digits, value);
+        _s = buffer;
+    }
+
+    const char* c_str() const { return _s.c_str(); }
+    unsigned length() const { return (unsigned)_s.size(); }
+    bool isEmpty() const { return _s.empty(); }
+    bool reserve(unsigned size) { _s.reserve(size); return true; }
+    char operator[](unsigned index) const { return index < _s.size() ? _s[index] : 0; }
+
+    String& operator+=(const String& other) { _s += other._s; return *this; }
+    String& operator+=(const char* other) { _s += other; return *this; }
+    String& operator+=(char c) { _s += c; return *this; }
+    friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+    friend String operator+(const String& a, const char* b) { return String(a._s + b); }
+    friend String operator+(const char* a, const String& b) { return String(a + b._s); }
+    bool operator==(const String& other) const { return _s == other._s; }
+    bool operator==(const char* other) const { return _s == other; }
+    bool operator!=(const String& other) const { return _s != other._s; }
+    bool operator!=(const char* other) const { return _s != other; }
+
+    int indexOf(char c, unsigned from = 0) const { return found(_s.find(c, from)); }
+    int indexOf(const char* text, unsigned from = 0) const { return found(_s.find(text, from)); }
+    int lastIndexOf(char c) const { return found(_s.rfind(c)); }
+    String substring(unsigned from) const { return substring(from, length()); }
+    String substring(unsigned from, unsigned to) const {
+        if (from > _s.size()) return String();
+        return String(_s.substr(from, to - from));
+    }
+    bool startsWith(const char* prefix) const { return _s.compare(0, strlen(prefix), prefix) == 0; }
+    long toInt() const { return atol(_s.c_str()); }
+    float toFloat() const { return (float)atof(_s.c_str()); }
+
+private:
+    static int found(size_t position) { return position == std::string::npos ? -1 : (int)position; }
+    std::string _s;
+};
+
+// ========== Fake Clock ==========
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);     // Advances the fake clock
+void yield();
+
+void hostSetMillis(unsigned long ms);
+void hostAdvanceMillis(unsigned long ms);
+
+// ========== GPIO ==========
+// Levels tests can set; inputs read HIGH (idle with a pull-up) until then.
+// Interrupt handlers are not called.
+#define LOW 0
+#define HIGH 1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define digitalPinToInterrupt(pin) (pin)
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t level);
+void attachInterrupt(uint8_t pin, void (*handler)(), int mode);
+
+void hostSetPin(uint8_t pin, int level);
+
+// ========== ESP ==========
+class EspClass {
+public:
+    void restart();     // Exits: nothing in a test should get here
+};
+extern EspClass ESP;
+
+// ========== Print / Stream ==========
+class Print;
+
+class Printable {
+public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print& p) const = 0;
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+    size_t write(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+
+    size_t print(const char* text) { return write(text); }
+    size_t print(const String& text) { return write(text.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(const Printable& value) { return value.printTo(*this); }
+    size_t print(int value) { return printf("%d", value); }
+    size_t print(unsigned value) { return printf("%u", value); }
+    size_t print(long value) { return printf("%ld", value); }
+    size_t print(unsigned long value) { return printf("%lu", value); }
+    size_t print(double value, int digits = 2) { return printf("%.*f", digits, value); }
+    size_t println() { return write("\r\n"); }
+    template <typename T> size_t println(T value) { size_t n = print(value); return n + println(); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+public:
+    Stream() : _timeout(1000) {}
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual void flush() {}
+
+    // No blocking on the host: returns what is available now
+    virtual size_t readBytes(char* buffer, size_t length) {
+        size_t n = 0;
+        while (n < length && available() > 0) {
+            buffer[n++] = (char)read();
+        }
+        return n;
+    }
+    size_t readBytes(uint8_t* buffer, size_t length) { return readBytes((char*)buffer, length); }
+    bool find(const char* target) { return findUntil(target, nullptr); }
+    bool findUntil(const char* target, const char* terminator);
+    void setTimeout(unsigned long timeout) { _timeout = timeout; }
+
+protected:
+    unsigned long _timeout;
+};
+
+// ========== Serial ==========
+#define SERIAL_8N1 0x800001c
+
+class HardwareSerial : public Stream {
+public:
+    explicit HardwareSerial(int uart) : _uart(uart) {}
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rx = -1, int8_t tx = -1) {}
+    void end() {}
+    size_t setRxBufferSize(size_t size) { return size; }
+    operator bool() const { return true; }
+
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+    size_t write(uint8_t c);
+    using Print::write;
+
+private:
+    int _uart;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial2;
+
+#endif // NATIVE_ARDUINO_H
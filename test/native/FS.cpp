@@ -0,0 +1,125 @@
+#include "FS.h"
+#include "SD.h"
+#include "LittleFS.h"
+
+namespace fs {
+
+// ========== File ==========
+
+const char* File::name() const {
+    size_t slash = _path.rfind('/');
+    return _path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+}
+
+File File::openNextFile() {
+    if (!_listing || _listing->empty()) return File();
+    std::string next = _listing->front();
+    _listing->erase(_listing->begin());
+    return _fs->open(next.c_str());
+}
+
+bool File::seek(uint32_t position) {
+    if (!_data || position > _data->size()) return false;
+    _position = position;
+    return true;
+}
+
+int File::read() {
+    if (!_data || _position >= _data->size()) return -1;
+    return (uint8_t)(*_data)[_position++];
+}
+
+int File::peek() {
+    if (!_data || _position >= _data->size()) return -1;
+    return (uint8_t)(*_data)[_position];
+}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+    if (!_data) return 0;
+    size_t n = std::min(size, _data->size() - _position);
+    memcpy(buffer, _data->data() + _position, n);
+    _position += n;
+    return n;
+}
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+    if (!_data) return 0;
+    if (_position + size > _data->size()) _data->resize(_position + size);
+    memcpy(&(*_data)[_position], buffer, size);
+    _position += size;
+    return size;
+}
+
+// ========== FS ==========
+
+File FS::open(const char* path, const char* mode, bool create) {
+    std::map<std::string, std::shared_ptr<std::string> >::iterator it = _files.find(path);
+    if (mode[0] == 'r') {
+        if (it == _files.end() && _dirs.count(path)) {
+            std::shared_ptr<std::vector<std::string> > listing = std::make_shared<std::vector<std::string> >();
+            std::string prefix = std::string(path) + "/";
+            for (it = _files.begin(); it != _files.end(); ++it) {
+                const std::string& name = it->first;
+                if (name.compare(0, prefix.size(), prefix) == 0 &&
+                    name.find('/', prefix.size()) == std::string::npos) {
+                    listing->push_back(name);
+                }
+            }
+            return File(this, path, listing);
+        }
+        if (it == _files.end()) return File();
+        return File(it->second, path, 0);
+    }
+    if (it == _files.end() || mode[0] == 'w') {
+        _files[path] = std::make_shared<std::string>();
+        it = _files.find(path);
+    }
+    return File(it->second, path, mode[0] == 'a' ? it->second->size() : 0);
+}
+
+bool FS::exists(const char* path) const {
+    return _files.count(path) > 0 || _dirs.count(path) > 0;
+}
+
+bool FS::remove(const char* path) {
+    return _files.erase(path) > 0;
+}
+
+bool FS::mkdir(const char* path) {
+    _dirs.insert(path);
+    return true;
+}
+
+bool FS::rename(const char* from, const char* to) {
+    std::map<std::string, std::shared_ptr<std::string> >::iterator it = _files.find(from);
+    if (it == _files.end()) return false;
+    _files[to] = it->second;
+    _files.erase(it);
+    return true;
+}
+
+uint64_t FS::usedBytes() const {
+    uint64_t used = 0;
+    std::map<std::string, std::shared_ptr<std::string> >::const_iterator it;
+    for (it = _files.begin(); it != _files.end(); ++it) used += it->second->size();
+    return used;
+}
+
+void FS::hostWrite(const char* path, const std::string& contents) {
+    _files[path] = std::make_shared<std::string>(contents);
+}
+
+std::string FS::hostRead(const char* path) const {
+    std::map<std::string, std::shared_ptr<std::string> >::const_iterator it = _files.find(path);
+    return it == _files.end() ? std::string() : *it->second;
+}
+
+void FS::hostFormat() {
+    _files.clear();
+    _dirs.clear();
+}
+
+} // namespace fs
+
+SDFS SD;
+LittleFSFS LittleFS;
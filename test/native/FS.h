@@ -0,0 +1,91 @@
+#ifndef NATIVE_FS_H
+#define NATIVE_FS_H
+
+#include <Arduino.h>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+// ========== Host File System Shim ==========
+// An in-memory stand-in for the Arduino FS API: each FS instance (SD,
+// LittleFS) is a map of path -> contents. Tests put files in place with
+// hostWrite() and read back what the firmware wrote with hostRead().
+// Opening a directory lists the files directly in it.
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+class FS;
+
+class File : public Stream {
+public:
+    File() : _position(0), _fs(nullptr) {}
+    File(std::shared_ptr<std::string> data, const std::string& path, size_t position)
+        : _data(data), _path(path), _position(position), _fs(nullptr) {}
+    File(FS* fs, const std::string& path, std::shared_ptr<std::vector<std::string> > listing)
+        : _path(path), _position(0), _listing(listing), _fs(fs) {}
+
+    operator bool() const { return _data || _listing; }
+    const char* path() const { return _path.c_str(); }
+    const char* name() const;
+    bool isDirectory() const { return (bool)_listing; }
+    File openNextFile();
+    size_t size() const { return _data ? _data->size() : 0; }
+    size_t position() const { return _position; }
+    bool seek(uint32_t position);
+    void close() { _data.reset(); _listing.reset(); }
+
+    int available() { return _data ? (int)(_data->size() - _position) : 0; }
+    int read();
+    int peek();
+    size_t read(uint8_t* buffer, size_t size);
+    size_t readBytes(char* buffer, size_t length) { return read((uint8_t*)buffer, length); }
+
+    size_t write(uint8_t c) { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size);
+    using Print::write;
+
+private:
+    std::shared_ptr<std::string> _data;
+    std::string _path;
+    size_t _position;
+    std::shared_ptr<std::vector<std::string> > _listing;    // Directory: paths not yet returned
+    FS* _fs;
+};
+
+class FS {
+public:
+    File open(const char* path, const char* mode = FILE_READ, bool create = false);
+    File open(const String& path, const char* mode = FILE_READ) { return open(path.c_str(), mode); }
+    bool exists(const char* path) const;
+    bool exists(const String& path) const { return exists(path.c_str()); }
+    bool remove(const char* path);
+    bool mkdir(const char* path);
+    bool rename(const char* from, const char* to);
+    uint64_t totalBytes() const { return _capacity; }
+    uint64_t usedBytes() const;
+
+    // Test hooks
+    void hostWrite(const char* path, const std::string& contents);
+    std::string hostRead(const char* path) const;
+    void hostFormat();                  // Drop every file and directory
+
+protected:
+    explicit FS(uint64_t capacity) : _capacity(capacity) {}
+
+    uint64_t _capacity;
+    std::map<std::string, std::shared_ptr<std::string> > _files;
+    std::set<std::string> _dirs;
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif // NATIVE_FS_H
@@ -0,0 +1,13 @@
+#ifndef NATIVE_LITTLEFS_H
+#define NATIVE_LITTLEFS_H
+
+#include "FS.h"
+
+class LittleFSFS : public fs::FS {
+public:
+    LittleFSFS() : FS(1472 * 1024) {}                   // default.csv's spiffs partition
+    bool begin(bool formatOnFail = false) { return true; }
+};
+extern LittleFSFS LittleFS;
+
+#endif // NATIVE_LITTLEFS_H
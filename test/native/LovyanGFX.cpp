@@ -0,0 +1,283 @@
+#include "LovyanGFX.hpp"
+
+namespace lgfx {
+
+HostDrawStats hostDrawStats = {0, 0};
+
+// ========== Fonts ==========
+// GLCD glyphs: 5 columns, LSB the top row
+static const uint8_t glcdFont[][5] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00},  // ' ' !
+    {0x00, 0x07, 0x00, 0x07, 0x00}, {0x14, 0x7F, 0x14, 0x7F, 0x14},  // " #
+    {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62},  // $ %
+    {0x36, 0x49, 0x56, 0x20, 0x50}, {0x00, 0x08, 0x07, 0x03, 0x00},  // & '
+    {0x00, 0x1C, 0x22, 0x41, 0x00}, {0x00, 0x41, 0x22, 0x1C, 0x00},  // ( )
+    {0x2A, 0x1C, 0x7F, 0x1C, 0x2A}, {0x08, 0x08, 0x3E, 0x08, 0x08},  // * +
+    {0x00, 0x80, 0x70, 0x30, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08},  // , -
+    {0x00, 0x00, 0x60, 0x60, 0x00}, {0x20, 0x10, 0x08, 0x04, 0x02},  // . /
+    {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00},  // 0 1
+    {0x72, 0x49, 0x49, 0x49, 0x46}, {0x21, 0x41, 0x49, 0x4D, 0x33},  // 2 3
+    {0x18, 0x14, 0x12, 0x7F, 0x10}, {0x27, 0x45, 0x45, 0x45, 0x39},  // 4 5
+    {0x3C, 0x4A, 0x49, 0x49, 0x31}, {0x41, 0x21, 0x11, 0x09, 0x07},  // 6 7
+    {0x36, 0x49, 0x49, 0x49, 0x36}, {0x46, 0x49, 0x49, 0x29, 0x1E},  // 8 9
+    {0x00, 0x00, 0x14, 0x00, 0x00}, {0x00, 0x40, 0x34, 0x00, 0x00},  // : ;
+    {0x00, 0x08, 0x14, 0x22, 0x41}, {0x14, 0x14, 0x14, 0x14, 0x14},  // < =
+    {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x59, 0x09, 0x06},  // > ?
+    {0x3E, 0x41, 0x5D, 0x59, 0x4E}, {0x7C, 0x12, 0x11, 0x12, 0x7C},  // @ A
+    {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22},  // B C
+    {0x7F, 0x41, 0x41, 0x41, 0x3E}, {0x7F, 0x49, 0x49, 0x49, 0x41},  // D E
+    {0x7F, 0x09, 0x09, 0x09, 0x01}, {0x3E, 0x41, 0x41, 0x51, 0x73},  // F G
+    {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00},  // H I
+    {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41},  // J K
+    {0x7F, 0x40, 0x40, 0x40, 0x40}, {0x7F, 0x02, 0x1C, 0x02, 0x7F},  // L M
+    {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E},  // N O
+    {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E},  // P Q
+    {0x7F, 0x09, 0x19, 0x29, 0x46}, {0x26, 0x49, 0x49, 0x49, 0x32},  // R S
+    {0x03, 0x01, 0x7F, 0x01, 0x03}, {0x3F, 0x40, 0x40, 0x40, 0x3F},  // T U
+    {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F},  // V W
+    {0x63, 0x14, 0x08, 0x14, 0x63}, {0x03, 0x04, 0x78, 0x04, 0x03},  // X Y
+    {0x61, 0x59, 0x49, 0x4D, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x41},  // Z [
+    {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x41, 0x7F},  // \ ]
+    {0x04, 0x02, 0x01, 0x02, 0x04}, {0x40, 0x40, 0x40, 0x40, 0x40},  // ^ _
+    {0x00, 0x03, 0x07, 0x08, 0x00}, {0x20, 0x54, 0x54, 0x78, 0x40},  // ` a
+    {0x7F, 0x28, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x28},  // b c
+    {0x38, 0x44, 0x44, 0x28, 0x7F}, {0x38, 0x54, 0x54, 0x54, 0x18},  // d e
+    {0x00, 0x08, 0x7E, 0x09, 0x02}, {0x18, 0xA4, 0xA4, 0x9C, 0x78},  // f g
+    {0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00},  // h i
+    {0x20, 0x40, 0x40, 0x3D, 0x00}, {0x7F, 0x10, 0x28, 0x44, 0x00},  // j k
+    {0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x78, 0x04, 0x78},  // l m
+    {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38},  // n o
+    {0xFC, 0x18, 0x24, 0x24, 0x18}, {0x18, 0x24, 0x24, 0x18, 0xFC},  // p q
+    {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x24},  // r s
+    {0x04, 0x04, 0x3F, 0x44, 0x24}, {0x3C, 0x40, 0x40, 0x20, 0x7C},  // t u
+    {0x1C, 0x20, 0x40, 0x20, 0x1C}, {0x3C, 0x40, 0x30, 0x40, 0x3C},  // v w
+    {0x44, 0x28, 0x10, 0x28, 0x44}, {0x4C, 0x90, 0x90, 0x90, 0x7C},  // x y
+    {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00},  // z {
+    {0x00, 0x00, 0x77, 0x00, 0x00}, {0x00, 0x41, 0x36, 0x08, 0x00},  // | }
+    {0x02, 0x01, 0x02, 0x04, 0x02},                                  // ~
+};
+static const uint8_t glcdDegree[5] = {0x00, 0x06, 0x09, 0x09, 0x06};    // 0xF7
+static const uint8_t glcdMissing[5] = {0x7F, 0x41, 0x41, 0x41, 0x7F};   // Anything else
+
+static const uint8_t* glcdGlyph(uint8_t c) {
+    if (c >= 0x20 && c <= 0x7E) return glcdFont[c - 0x20];
+    if (c == 0xF7) return glcdDegree;
+    return glcdMissing;
+}
+
+namespace fonts {
+const IFont Font0 = {6, 8, 1};
+const IFont Font2 = {8, 16, 2};     // Stand-in, see LovyanGFX.hpp
+}
+
+// ========== Canvas ==========
+LovyanGFX::LovyanGFX()
+    : _buffer(nullptr), _width(0), _height(0), _depth(16),
+      _font(&fonts::Font0), _textSizeX(1), _textSizeY(1), _textDatum(top_left),
+      _textWrapX(true), _textFg(0xFFFF), _textBg(0xFFFF), _cursorX(0), _cursorY(0) {}
+
+LovyanGFX::~LovyanGFX() {}
+
+void LovyanGFX::hostSetCanvas(void* buffer, int32_t w, int32_t h, uint8_t depth) {
+    _buffer = (uint8_t*)buffer;
+    _width = buffer ? w : 0;
+    _height = buffer ? h : 0;
+    _depth = depth;
+}
+
+uint32_t LovyanGFX::fillClipped(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > _width) w = _width - x;
+    if (y + h > _height) h = _height - y;
+    if (w <= 0 || h <= 0) return 0;
+
+    if (_depth == 1) {
+        int32_t rowBytes = (_width + 7) / 8;
+        for (int32_t row = y; row < y + h; row++) {
+            uint8_t* line = _buffer + row * rowBytes;
+            for (int32_t col = x; col < x + w; col++) {
+                uint8_t mask = 0x80 >> (col & 7);
+                if (color) line[col >> 3] |= mask;
+                else line[col >> 3] &= ~mask;
+            }
+        }
+    } else {
+        uint16_t swapped = (uint16_t)(color << 8 | color >> 8);
+        for (int32_t row = y; row < y + h; row++) {
+            uint16_t* line = (uint16_t*)_buffer + row * _width;
+            std::fill(line + x, line + x + w, swapped);
+        }
+    }
+    return (uint32_t)w * h;
+}
+
+void LovyanGFX::hostFill(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    hostDrawStats.calls++;
+    hostDrawStats.pixels += fillClipped(x, y, w, h, color);
+}
+
+void LovyanGFX::hostRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    hostDrawStats.calls++;
+    if (w <= 0 || h <= 0) return;
+    uint32_t n = fillClipped(x, y, w, 1, color);
+    if (h > 1) n += fillClipped(x, y + h - 1, w, 1, color);
+    if (h > 2) {
+        n += fillClipped(x, y + 1, 1, h - 2, color);
+        if (w > 1) n += fillClipped(x + w - 1, y + 1, 1, h - 2, color);
+    }
+    hostDrawStats.pixels += n;
+}
+
+void LovyanGFX::hostLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color) {
+    hostDrawStats.calls++;
+    int32_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int32_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int32_t err = dx + dy;
+    while (true) {
+        hostDrawStats.pixels += fillClipped(x0, y0, 1, 1, color);
+        if (x0 == x1 && y0 == y1) break;
+        int32_t e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+uint16_t LovyanGFX::readPixel(int32_t x, int32_t y) const {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+    if (_depth == 1) {
+        uint8_t bits = _buffer[y * ((_width + 7) / 8) + (x >> 3)];
+        return (bits & (0x80 >> (x & 7))) ? 1 : 0;
+    }
+    uint16_t raw = ((const uint16_t*)_buffer)[y * _width + x];
+    return (uint16_t)(raw << 8 | raw >> 8);
+}
+
+void LovyanGFX::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* data,
+                          color_depth_t depth, const uint16_t* palette) {
+    hostDrawStats.calls++;
+    int32_t rowBytes = (w + 7) / 8;
+    for (int32_t row = 0; row < h; row++) {
+        for (int32_t col = 0; col < w; col++) {
+            bool set = data[row * rowBytes + (col >> 3)] & (0x80 >> (col & 7));
+            hostDrawStats.pixels += fillClipped(x + col, y + row, 1, 1, palette[set ? 1 : 0]);
+        }
+    }
+}
+
+void LovyanGFX::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, const swap565_t* data) {
+    hostDrawStats.calls++;
+    for (int32_t row = 0; row < h; row++) {
+        for (int32_t col = 0; col < w; col++) {
+            uint16_t raw = data[row * w + col].raw;
+            hostDrawStats.pixels += fillClipped(x + col, y + row, 1, 1, (uint16_t)(raw << 8 | raw >> 8));
+        }
+    }
+}
+
+// ========== Text ==========
+// One character cell; with different fore/back colours the whole cell is filled
+int32_t LovyanGFX::hostGlyph(uint8_t c, int32_t x, int32_t y) {
+    const uint8_t* glyph = glcdGlyph(c);
+    float sx = _textSizeX;
+    float sy = _textSizeY * _font->glyphScaleY;
+    int32_t left = x + (_font->cellWidth - 6) / 2 * (int32_t)sx;     // Font2: glyph centred in its cell
+    int32_t cellW = fontWidth();
+
+    uint32_t n = 0;
+    if (_textBg != _textFg) n += fillClipped(x, y, cellW, fontHeight(), _textBg);
+    for (int32_t col = 0; col < 5; col++) {
+        int32_t x0 = left + (int32_t)(col * sx), x1 = left + (int32_t)((col + 1) * sx);
+        for (int32_t row = 0; row < 8; row++) {
+            if (!(glyph[col] & (1 << row))) continue;
+            int32_t y0 = y + (int32_t)(row * sy), y1 = y + (int32_t)((row + 1) * sy);
+            n += fillClipped(x0, y0, x1 - x0, y1 - y0, _textFg);
+        }
+    }
+    hostDrawStats.calls++;
+    hostDrawStats.pixels += n;
+    return cellW;
+}
+
+size_t LovyanGFX::drawChar(uint16_t c, int32_t x, int32_t y) {
+    return hostGlyph((uint8_t)c, x, y);
+}
+
+int32_t LovyanGFX::textWidth(const char* text) const {
+    return (int32_t)strlen(text) * fontWidth();
+}
+
+size_t LovyanGFX::drawString(const char* text, int32_t x, int32_t y) {
+    int32_t w = textWidth(text);
+    if (_textDatum & 1) x -= w / 2;             // Centre
+    else if (_textDatum & 2) x -= w;            // Right
+    if (_textDatum & 4) y -= fontHeight() / 2;  // Middle
+    else if (_textDatum & 8) y -= fontHeight(); // Bottom
+
+    for (const char* p = text; *p; p++) {
+        x += hostGlyph((uint8_t)*p, x, y);
+    }
+    return w;
+}
+
+size_t LovyanGFX::write(uint8_t c) {
+    if (c == '\r') return 1;
+    if (c == '\n') {
+        _cursorX = 0;
+        _cursorY += fontHeight();
+        return 1;
+    }
+    if (_textWrapX && _cursorX + fontWidth() > _width) {
+        _cursorX = 0;
+        _cursorY += fontHeight();
+    }
+    _cursorX += hostGlyph(c, _cursorX, _cursorY);
+    return 1;
+}
+
+// ========== Panel ==========
+bool LGFX_Device::init() {
+    if (_panel == nullptr) return false;
+    const Panel_Device::config_t& cfg = _panel->config();
+    free(_frame);
+    _frame = (uint8_t*)calloc((size_t)cfg.panel_width * cfg.panel_height, sizeof(uint16_t));
+    applyRotation();
+    return _frame != nullptr;
+}
+
+void LGFX_Device::setRotation(uint8_t rotation) {
+    _rotation = rotation & 3;
+    applyRotation();
+}
+
+// The framebuffer is simply reinterpreted at the new size - rotating does
+// not move what is already drawn, as on the device
+void LGFX_Device::applyRotation() {
+    if (_frame == nullptr) return;
+    const Panel_Device::config_t& cfg = _panel->config();
+    bool landscape = _rotation & 1;
+    hostSetCanvas(_frame, landscape ? cfg.panel_height : cfg.panel_width,
+                  landscape ? cfg.panel_width : cfg.panel_height, 16);
+}
+
+} // namespace lgfx
+
+// ========== Sprites ==========
+void* LGFX_Sprite::createSprite(int32_t w, int32_t h) {
+    deleteSprite();
+    size_t bytes = (_bits == 1) ? (size_t)(w + 7) / 8 * h : (size_t)w * h * sizeof(uint16_t);
+    _owned = (uint8_t*)calloc(bytes, 1);
+    hostSetCanvas(_owned, w, h, _bits);
+    return _owned;
+}
+
+void LGFX_Sprite::deleteSprite() {
+    free(_owned);
+    _owned = nullptr;
+    hostSetCanvas(nullptr, 0, 0, _bits);
+}
+
+void LGFX_Sprite::setBuffer(void* buffer, int32_t w, int32_t h, uint8_t bits) {
+    deleteSprite();
+    hostSetCanvas(buffer, w, h, bits == 1 ? 1 : 16);
+}
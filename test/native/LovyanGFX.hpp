@@ -0,0 +1,299 @@
+#ifndef NATIVE_LOVYANGFX_HPP
+#define NATIVE_LOVYANGFX_HPP
+
+// ========== Host LovyanGFX Shim ==========
+// A software RGB565 canvas with the part of the LovyanGFX API the display
+// code uses, so screens can be rendered and compared on a PC. Sprites keep
+// their pixels byte-swapped (big-endian) like the real library, so code
+// that reads getBuffer() sees the same bytes as on the device.
+//
+// Colours follow LovyanGFX's rule of going by the argument type: 8-bit is
+// RGB332, 16-bit and signed int RGB565, unsigned 32-bit RGB888.
+//
+// Font0 is the classic 6x8 GLCD font, as on the device. Font2 is only
+// approximated (the same glyphs, doubled in height, on a fixed 8x16 cell):
+// text in it lands in the right box but is not pixel-identical to the
+// panel. Text is drawn byte by byte - there is no UTF-8 decoding.
+
+#include <Arduino.h>
+
+#define TFT_BLACK    0x0000
+#define TFT_WHITE    0xFFFF
+#define TFT_RED      0xF800
+#define TFT_GREEN    0x07E0
+#define TFT_YELLOW   0xFFE0
+#define TFT_DARKGREY 0x7BEF
+
+#define HSPI_HOST 2
+#define VSPI_HOST 3
+#define SPI_DMA_CH_AUTO 3
+
+namespace lgfx {
+
+struct IFont {
+    uint8_t cellWidth;      // Advance per character at text size 1
+    uint8_t cellHeight;
+    uint8_t glyphScaleY;    // GLCD glyph rows are drawn this many pixels tall
+};
+
+namespace fonts {
+extern const IFont Font0;
+extern const IFont Font2;
+}
+
+enum color_depth_t : uint8_t {
+    palette_1bit = 1,
+    rgb565_2Byte = 16,
+};
+
+struct swap565_t { uint16_t raw; };
+
+namespace textdatum {
+enum textdatum_t : uint8_t {
+    top_left = 0, top_center = 1, top_right = 2,
+    middle_left = 4, middle_center = 5, middle_right = 6,
+    bottom_left = 8, bottom_center = 9, bottom_right = 10,
+};
+}
+using namespace textdatum;
+
+// Every draw call on any target, for render benchmarks on the host
+struct HostDrawStats {
+    uint32_t calls;
+    uint32_t pixels;        // Pixels written, after clipping
+};
+extern HostDrawStats hostDrawStats;
+
+// Colour argument -> RGB565, by argument type
+inline uint16_t hostColor(uint8_t c) {
+    uint16_t r = c >> 5, g = (c >> 2) & 7, b = c & 3;
+    return (uint16_t)((r << 13 | r << 10 | (r >> 1) << 11) & 0xF800) |
+           (uint16_t)(g << 8 | g << 5) | (uint16_t)(b << 3 | b << 1 | b >> 1);
+}
+inline uint16_t hostColor(int8_t c) { return hostColor((uint8_t)c); }
+inline uint16_t hostColor(uint16_t c) { return c; }
+inline uint16_t hostColor(int16_t c) { return (uint16_t)c; }
+inline uint16_t hostColor(int c) { return (uint16_t)c; }
+inline uint16_t hostColor(long c) { return (uint16_t)c; }
+inline uint16_t hostColor(uint32_t c) {
+    return ((c >> 8) & 0xF800) | ((c >> 5) & 0x07E0) | ((c >> 3) & 0x001F);
+}
+inline uint16_t hostColor(unsigned long c) { return hostColor((uint32_t)c); }
+
+class LovyanGFX : public Print {
+public:
+    LovyanGFX();
+    virtual ~LovyanGFX();
+
+    int32_t width() const { return _width; }
+    int32_t height() const { return _height; }
+
+    void startWrite(bool transaction = true) {}
+    void endWrite() {}
+    void waitDMA() {}
+    bool getTouch(uint16_t* x, uint16_t* y) { return false; }
+
+    // ----- Drawing -----
+    template <typename T> void fillScreen(const T& color) { hostFill(0, 0, _width, _height, hostColor(color)); }
+    template <typename T> void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, const T& color) {
+        hostFill(x, y, w, h, hostColor(color));
+    }
+    template <typename T> void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, const T& color) {
+        hostRect(x, y, w, h, hostColor(color));
+    }
+    template <typename T> void drawFastHLine(int32_t x, int32_t y, int32_t w, const T& color) {
+        hostFill(x, y, w, 1, hostColor(color));
+    }
+    template <typename T> void drawFastVLine(int32_t x, int32_t y, int32_t h, const T& color) {
+        hostFill(x, y, 1, h, hostColor(color));
+    }
+    template <typename T> void drawPixel(int32_t x, int32_t y, const T& color) {
+        hostFill(x, y, 1, 1, hostColor(color));
+    }
+    template <typename T> void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, const T& color) {
+        hostLine(x0, y0, x1, y1, hostColor(color));
+    }
+
+    // 1-bit image: set bits take palette[1], clear bits palette[0]
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* data,
+                   color_depth_t depth, const uint16_t* palette);
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, const swap565_t* data);
+
+    uint16_t readPixel(int32_t x, int32_t y) const;     // RGB565, 0 off the canvas
+
+    // ----- Text -----
+    void setFont(const IFont* font) { _font = font; }
+    void setTextSize(float size) { setTextSize(size, size); }
+    void setTextSize(float sx, float sy) { _textSizeX = sx; _textSizeY = sy; }
+    void setTextDatum(uint8_t datum) { _textDatum = datum; }
+    void setTextWrap(bool wrapX, bool wrapY = false) { _textWrapX = wrapX; }
+    template <typename T> void setTextColor(const T& color) {
+        _textFg = _textBg = hostColor(color);           // Same colours: transparent background
+    }
+    template <typename T1, typename T2> void setTextColor(const T1& fg, const T2& bg) {
+        _textFg = hostColor(fg);
+        _textBg = hostColor(bg);
+    }
+    void setCursor(int32_t x, int32_t y) { _cursorX = x; _cursorY = y; }
+    int32_t getCursorX() const { return _cursorX; }
+    int32_t getCursorY() const { return _cursorY; }
+
+    size_t drawChar(uint16_t c, int32_t x, int32_t y);
+    size_t drawString(const char* text, int32_t x, int32_t y);
+    size_t drawString(const String& text, int32_t x, int32_t y) { return drawString(text.c_str(), x, y); }
+    int32_t textWidth(const char* text) const;
+    int32_t textWidth(const String& text) const { return textWidth(text.c_str()); }
+    int32_t fontWidth() const { return (int32_t)(_font->cellWidth * _textSizeX); }
+    int32_t fontHeight() const { return (int32_t)(_font->cellHeight * _textSizeY); }
+
+    size_t write(uint8_t c);                // print(): at the cursor, wrapping at the right edge
+    using Print::write;
+
+protected:
+    // Point the canvas at pixel memory (nullptr: nothing to draw on)
+    void hostSetCanvas(void* buffer, int32_t w, int32_t h, uint8_t depth);
+
+    void hostFill(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+    void hostRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+    void hostLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color);
+    int32_t hostGlyph(uint8_t c, int32_t x, int32_t y);
+
+    uint8_t* _buffer;
+    int32_t _width;
+    int32_t _height;
+    uint8_t _depth;             // 16, or 1 (palette index = colour != 0)
+
+private:
+    uint32_t fillClipped(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+
+    const IFont* _font;
+    float _textSizeX;
+    float _textSizeY;
+    uint8_t _textDatum;
+    bool _textWrapX;
+    uint16_t _textFg;
+    uint16_t _textBg;
+    int32_t _cursorX;
+    int32_t _cursorY;
+};
+
+// ========== Panel Configuration ==========
+// The device's config structs, kept so display.cpp builds unchanged; only
+// the panel size is used.
+struct Bus_SPI {
+    struct config_t {
+        int spi_host = 0, spi_mode = 0;
+        uint32_t freq_write = 0, freq_read = 0;
+        bool spi_3wire = false, use_lock = false;
+        int dma_channel = 0;
+        int pin_sclk = -1, pin_mosi = -1, pin_miso = -1, pin_dc = -1;
+    };
+    const config_t& config() const { return _cfg; }
+    void config(const config_t& cfg) { _cfg = cfg; }
+private:
+    config_t _cfg;
+};
+
+struct Light_PWM {
+    struct config_t {
+        int pin_bl = -1;
+        bool invert = false;
+        uint32_t freq = 0;
+        int pwm_channel = 0;
+    };
+    const config_t& config() const { return _cfg; }
+    void config(const config_t& cfg) { _cfg = cfg; }
+private:
+    config_t _cfg;
+};
+
+struct Touch_XPT2046 {
+    struct config_t {
+        int x_min = 0, x_max = 0, y_min = 0, y_max = 0;
+        int pin_int = -1, pin_cs = -1, pin_rst = -1;
+        int spi_host = 0;
+        uint32_t freq = 0;
+        bool bus_shared = false;
+        int offset_rotation = 0;
+    };
+    const config_t& config() const { return _cfg; }
+    void config(const config_t& cfg) { _cfg = cfg; }
+private:
+    config_t _cfg;
+};
+
+struct Panel_Device {
+    struct config_t {
+        int pin_cs = -1, pin_rst = -1, pin_busy = -1;
+        int memory_width = 0, memory_height = 0;
+        int panel_width = 0, panel_height = 0;
+        int offset_x = 0, offset_y = 0, offset_rotation = 0;
+        int dummy_read_pixel = 0, dummy_read_bits = 0;
+        bool readable = false, invert = false, rgb_order = false;
+        bool dlen_16bit = false, bus_shared = false;
+    };
+    const config_t& config() const { return _cfg; }
+    void config(const config_t& cfg) { _cfg = cfg; }
+    void setBus(Bus_SPI* bus) {}
+    void setLight(Light_PWM* light) {}
+    void setTouch(Touch_XPT2046* touch) {}
+private:
+    config_t _cfg;
+};
+
+struct Panel_ST7796 : public Panel_Device {};
+
+// The panel: a framebuffer of the configured size, allocated by init()
+class LGFX_Device : public LovyanGFX {
+public:
+    LGFX_Device() : _panel(nullptr), _frame(nullptr), _rotation(0), _brightness(0) {}
+    ~LGFX_Device() { free(_frame); }
+
+    bool init();
+    void setRotation(uint8_t rotation);
+    void setBrightness(uint8_t brightness) { _brightness = brightness; }
+    uint8_t getBrightness() const { return _brightness; }
+
+protected:
+    void setPanel(Panel_Device* panel) { _panel = panel; }
+
+private:
+    void applyRotation();
+
+    Panel_Device* _panel;
+    uint8_t* _frame;
+    uint8_t _rotation;
+    uint8_t _brightness;
+};
+
+} // namespace lgfx
+
+// RAM canvas: 16-bit RGB565, or 1-bit with a two-colour palette
+class LGFX_Sprite : public lgfx::LovyanGFX {
+public:
+    LGFX_Sprite() : _bits(16), _owned(nullptr) {}
+    explicit LGFX_Sprite(lgfx::LovyanGFX* parent) : LGFX_Sprite() {}
+    ~LGFX_Sprite() { deleteSprite(); }
+
+    void setColorDepth(int bits) { _bits = (bits == 1) ? 1 : 16; }
+    void setPsram(bool enabled) {}
+    void* createSprite(int32_t w, int32_t h);
+    void deleteSprite();
+    bool createPalette() { return _depth == 1; }
+
+    // Draw into caller-owned memory
+    void setBuffer(void* buffer, int32_t w, int32_t h, uint8_t bits = 16);
+
+    void* getBuffer() { return _buffer; }
+    const void* getBuffer() const { return _buffer; }
+
+private:
+    uint8_t _bits;
+    uint8_t* _owned;
+};
+
+using lgfx::LovyanGFX;
+using lgfx::textdatum::textdatum_t;
+namespace fonts = lgfx::fonts;
+
+#endif // NATIVE_LOVYANGFX_HPP
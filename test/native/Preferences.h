@@ -0,0 +1,32 @@
+#ifndef NATIVE_PREFERENCES_H
+#define NATIVE_PREFERENCES_H
+
+#include <Arduino.h>
+
+// ========== Host Preferences Shim ==========
+// A namespace that is always empty: every get returns its default, so
+// loadConfig() yields the firmware defaults. Puts are accepted and dropped.
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false) { return true; }
+    void end() {}
+    bool clear() { return true; }
+
+    String getString(const char* key, const String& value = String()) { return value; }
+    bool getBool(const char* key, bool value = false) { return value; }
+    uint8_t getUChar(const char* key, uint8_t value = 0) { return value; }
+    uint16_t getUShort(const char* key, uint16_t value = 0) { return value; }
+    uint32_t getULong(const char* key, uint32_t value = 0) { return value; }
+    float getFloat(const char* key, float value = 0) { return value; }
+
+    size_t putString(const char* key, const char* value) { return strlen(value); }
+    size_t putString(const char* key, const String& value) { return value.length(); }
+    size_t putBool(const char* key, bool value) { return 1; }
+    size_t putUChar(const char* key, uint8_t value) { return 1; }
+    size_t putUShort(const char* key, uint16_t value) { return 2; }
+    size_t putULong(const char* key, uint32_t value) { return 4; }
+    size_t putFloat(const char* key, float value) { return 4; }
+};
+
+#endif // NATIVE_PREFERENCES_H
@@ -0,0 +1,40 @@
+#ifndef NATIVE_RTCLIB_H
+#define NATIVE_RTCLIB_H
+
+#include <Arduino.h>
+
+// ========== Host RTClib Shim ==========
+// DateTime keeps the fields it was built from; the RTC reads back whatever
+// the test set with hostSetTime() (default 2024-01-01 12:00:00).
+
+class DateTime {
+public:
+    DateTime(uint16_t year = 2000, uint8_t month = 1, uint8_t day = 1,
+             uint8_t hour = 0, uint8_t minute = 0, uint8_t second = 0)
+        : _year(year), _month(month), _day(day), _hour(hour), _minute(minute), _second(second) {}
+
+    uint16_t year() const { return _year; }
+    uint8_t month() const { return _month; }
+    uint8_t day() const { return _day; }
+    uint8_t hour() const { return _hour; }
+    uint8_t minute() const { return _minute; }
+    uint8_t second() const { return _second; }
+
+private:
+    uint16_t _year;
+    uint8_t _month, _day, _hour, _minute, _second;
+};
+
+class RTC_DS3231 {
+public:
+    RTC_DS3231() : _now(2024, 1, 1, 12, 0, 0) {}
+    bool begin() { return true; }
+    DateTime now() { return _now; }
+    void adjust(const DateTime& time) { _now = time; }
+    void hostSetTime(const DateTime& time) { _now = time; }
+
+private:
+    DateTime _now;
+};
+
+#endif // NATIVE_RTCLIB_H
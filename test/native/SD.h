@@ -0,0 +1,18 @@
+#ifndef NATIVE_SD_H
+#define NATIVE_SD_H
+
+#include "FS.h"
+
+// No card unless a test inserts one
+class SDFS : public fs::FS {
+public:
+    SDFS() : FS(8ULL << 30), _inserted(false) {}     // An 8 GB card
+    bool begin(uint8_t ssPin = 5) { return _inserted; }
+    void hostInsert(bool inserted) { _inserted = inserted; }
+
+private:
+    bool _inserted;
+};
+extern SDFS SD;
+
+#endif // NATIVE_SD_H
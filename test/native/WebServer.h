@@ -0,0 +1,12 @@
+#ifndef NATIVE_WEBSERVER_H
+#define NATIVE_WEBSERVER_H
+
+#include <Arduino.h>
+
+// Declared by global_state.h; nothing in [env:native] serves HTTP
+class WebServer {
+public:
+    explicit WebServer(int port) {}
+};
+
+#endif // NATIVE_WEBSERVER_H
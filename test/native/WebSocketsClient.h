@@ -0,0 +1,10 @@
+#ifndef NATIVE_WEBSOCKETSCLIENT_H
+#define NATIVE_WEBSOCKETSCLIENT_H
+
+#include <Arduino.h>
+
+// Declared by global_state.h; FluidNC traffic reaches the native tests
+// through the transport callbacks instead (host_fakes.h)
+class WebSocketsClient {};
+
+#endif // NATIVE_WEBSOCKETSCLIENT_H
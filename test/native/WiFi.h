@@ -0,0 +1,70 @@
+#ifndef NATIVE_WIFI_H
+#define NATIVE_WIFI_H
+
+#include <Arduino.h>
+
+// ========== Host WiFi Shim ==========
+// Reports whatever link the test set up with hostConnect() (default: not
+// connected). Nothing goes on a network.
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_CONNECTED = 3,
+    WL_DISCONNECTED = 6,
+} wl_status_t;
+
+typedef enum {
+    WIFI_OFF = 0,
+    WIFI_STA = 1,
+    WIFI_AP = 2,
+} wifi_mode_t;
+
+class IPAddress : public Printable {
+public:
+    IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) {
+        _octets[0] = a; _octets[1] = b; _octets[2] = c; _octets[3] = d;
+    }
+    uint8_t operator[](int index) const { return _octets[index]; }
+    String toString() const {
+        char buffer[16];
+        snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", _octets[0], _octets[1], _octets[2], _octets[3]);
+        return String(buffer);
+    }
+    size_t printTo(Print& p) const { return p.print(toString()); }
+
+private:
+    uint8_t _octets[4];
+};
+
+class WiFiClass {
+public:
+    WiFiClass() : _status(WL_DISCONNECTED), _mode(WIFI_STA), _rssi(0) {}
+
+    wl_status_t status() const { return _status; }
+    String SSID() const { return _status == WL_CONNECTED ? _ssid : String(); }
+    IPAddress localIP() const { return _status == WL_CONNECTED ? _ip : IPAddress(); }
+    int8_t RSSI() const { return _status == WL_CONNECTED ? _rssi : 0; }
+    bool disconnect() { _status = WL_DISCONNECTED; return true; }
+
+    bool mode(wifi_mode_t mode) { _mode = mode; return true; }
+    bool softAP(const char* ssid) { return true; }
+    IPAddress softAPIP() const { return IPAddress(192, 168, 4, 1); }
+
+    // Test hook
+    void hostConnect(const char* ssid, const IPAddress& ip, int8_t rssi) {
+        _status = WL_CONNECTED;
+        _ssid = ssid;
+        _ip = ip;
+        _rssi = rssi;
+    }
+
+private:
+    wl_status_t _status;
+    wifi_mode_t _mode;
+    String _ssid;
+    IPAddress _ip;
+    int8_t _rssi;
+};
+extern WiFiClass WiFi;
+
+#endif // NATIVE_WIFI_H
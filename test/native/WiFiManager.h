@@ -0,0 +1,9 @@
+#ifndef NATIVE_WIFIMANAGER_H
+#define NATIVE_WIFIMANAGER_H
+
+#include <Arduino.h>
+
+// Declared by global_state.h; nothing in [env:native] configures WiFi
+class WiFiManager {};
+
+#endif // NATIVE_WIFIMANAGER_H
@@ -0,0 +1,12 @@
+#ifndef NATIVE_WIRE_H
+#define NATIVE_WIRE_H
+
+#include <Arduino.h>
+
+// Included alongside RTClib; the I2C bus itself is not simulated
+class TwoWire {
+public:
+    bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) { return true; }
+};
+
+#endif // NATIVE_WIRE_H
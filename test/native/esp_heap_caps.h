@@ -0,0 +1,13 @@
+#ifndef NATIVE_ESP_HEAP_CAPS_H
+#define NATIVE_ESP_HEAP_CAPS_H
+
+#include <cstdint>
+#include <cstdlib>
+
+// One heap on the host: every capability is plain malloc
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+inline void* heap_caps_malloc(size_t size, uint32_t caps) { return malloc(size); }
+
+#endif // NATIVE_ESP_HEAP_CAPS_H
@@ -0,0 +1,49 @@
+#include "host_fakes.h"
+#include "network/fluidnc_transport.h"
+#include "sensors/sensors.h"
+
+// ========== network.cpp ==========
+HostTransportEvents hostTransport;
+
+void hostResetTransport() {
+    hostTransport.connected = 0;
+    hostTransport.disconnected = 0;
+    hostTransport.messages.clear();
+}
+
+void fluidncTransportConnected() {
+    hostTransport.connected++;
+}
+
+void fluidncTransportDisconnected() {
+    hostTransport.disconnected++;
+}
+
+void fluidncTransportMessage(const char* data, size_t length) {
+    hostTransport.messages.push_back(std::string(data, length));
+}
+
+// ========== sensors.cpp ==========
+std::vector<SensorMapping> sensorMappings;
+
+bool lockSensorBus(uint32_t waitMs) {
+    return true;
+}
+
+void unlockSensorBus() {}
+
+const SensorMapping* getSensorMappingByPosition(int8_t position) {
+    for (size_t i = 0; i < sensorMappings.size(); i++) {
+        if (sensorMappings[i].displayPosition == position && sensorMappings[i].enabled) {
+            return &sensorMappings[i];
+        }
+    }
+    return nullptr;
+}
+
+// ========== web_handlers.cpp ==========
+int hostWebServerStarts = 0;
+
+void setupWebServer() {
+    hostWebServerStarts++;
+}
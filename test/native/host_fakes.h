@@ -0,0 +1,28 @@
+#ifndef HOST_FAKES_H
+#define HOST_FAKES_H
+
+#include <Arduino.h>
+#include <string>
+#include <vector>
+
+// ========== Host Fakes ==========
+// Stand-ins for what [env:native] does not build (network.cpp,
+// sensors.cpp, web_handlers.cpp), recording calls so tests can check them.
+
+// FluidNC transport callbacks (network.cpp)
+struct HostTransportEvents {
+    int connected;
+    int disconnected;
+    std::vector<std::string> messages;
+};
+extern HostTransportEvents hostTransport;
+
+void hostResetTransport();
+
+// Sensor names (sensors.cpp): tests fill sensorMappings (sensors.h) directly;
+// the bus lock is always free
+
+// Web server (web_handlers.cpp)
+extern int hostWebServerStarts;
+
+#endif // HOST_FAKES_H
@@ -0,0 +1,94 @@
+// FluidNC state hand-off to core 1 and the DRO motion estimator behind it
+#include <unity.h>
+#include "state/global_state.h"
+#include "network/status_parser.h"
+#include "display/motion_estimator.h"
+
+// What the two cores do with one status report: core 0 parses and
+// publishes, core 1 refreshes its view and samples it
+static void deliver(const char* report) {
+    TEST_ASSERT_TRUE(parseFluidNCStatus(report, strlen(report)));
+    publishFluidNCState();
+    refreshFluidNCView();
+    updateMotionEstimator();
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_changed_report_is_published() {
+    hostAdvanceMillis(1000);
+    uint32_t sequence = fluidncSnapshot.sequence();
+    deliver("<Idle|MPos:1.000,2.000,3.000|FS:0,0>");
+
+    TEST_ASSERT_NOT_EQUAL(sequence, fluidncSnapshot.sequence());
+    TEST_ASSERT_EQUAL(MACHINE_IDLE, fluidncView.machineState);
+    TEST_ASSERT_EQUAL_FLOAT(2.0f, fluidncView.posY);
+    TEST_ASSERT_EQUAL_UINT32(fluidnc.reportCount, fluidncView.reportCount);
+}
+
+void test_nothing_new_is_not_published() {
+    hostAdvanceMillis(1000);
+    deliver("<Idle|MPos:1.000,2.000,3.000|FS:0,0>");
+    uint32_t sequence = fluidncSnapshot.sequence();
+
+    publishFluidNCState();
+    TEST_ASSERT_EQUAL_UINT32(sequence, fluidncSnapshot.sequence());
+}
+
+void test_unchanged_report_is_published() {
+    hostAdvanceMillis(1000);
+    deliver("<Idle|MPos:1.000,2.000,3.000|FS:0,0>");
+    uint32_t version = fluidnc.stateVersion;
+    uint32_t sequence = fluidncSnapshot.sequence();
+
+    hostAdvanceMillis(200);
+    deliver("<Idle|MPos:1.000,2.000,3.000|FS:0,0>");
+
+    TEST_ASSERT_EQUAL_UINT32(version, fluidnc.stateVersion);  // Nothing changed...
+    TEST_ASSERT_NOT_EQUAL(sequence, fluidncSnapshot.sequence());  // ...but it still went out
+    TEST_ASSERT_EQUAL_UINT32(fluidnc.reportCount, fluidncView.reportCount);
+    TEST_ASSERT_EQUAL_UINT32(millis(), fluidncView.reportTime);
+}
+
+void test_moving_reports_extrapolate() {
+    float wpos[4];
+    hostAdvanceMillis(1000);
+    deliver("<Jog|MPos:0.000,0.000,0.000|FS:6000,0>");
+    hostAdvanceMillis(200);
+    deliver("<Jog|MPos:10.000,0.000,0.000|FS:6000,0>");   // 0.05 mm/ms
+
+    hostAdvanceMillis(100);
+    TEST_ASSERT_TRUE(estimateWorkPosition(wpos));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 15.0f, wpos[0]);
+}
+
+void test_identical_reports_stop_extrapolation() {
+    float wpos[4];
+    hostAdvanceMillis(1000);
+    deliver("<Jog|MPos:0.000,0.000,0.000|FS:6000,0>");
+    hostAdvanceMillis(200);
+    deliver("<Jog|MPos:10.000,0.000,0.000|FS:6000,0>");
+    hostAdvanceMillis(50);
+    TEST_ASSERT_TRUE(estimateWorkPosition(wpos));
+
+    // The axes stopped: the next report repeats the last one exactly
+    hostAdvanceMillis(150);
+    deliver("<Jog|MPos:10.000,0.000,0.000|FS:6000,0>");
+    hostAdvanceMillis(50);
+    TEST_ASSERT_FALSE(estimateWorkPosition(wpos));
+    TEST_ASSERT_EQUAL_FLOAT(10.0f, wpos[0]);
+}
+
+int main(int argc, char** argv) {
+    loadConfig();
+    initGlobalState();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_changed_report_is_published);
+    RUN_TEST(test_nothing_new_is_not_published);
+    RUN_TEST(test_unchanged_report_is_published);
+    RUN_TEST(test_moving_reports_extrapolate);
+    RUN_TEST(test_identical_reports_stop_extrapolation);
+    return UNITY_END();
+}
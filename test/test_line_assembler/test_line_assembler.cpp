@@ -0,0 +1,110 @@
+// LineAssembler: reports split across reads, oversized lines, tail handling
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "network/line_assembler.h"
+
+static std::vector<std::string> lines;
+
+static void collectLine(const char* line, size_t length) {
+    lines.push_back(std::string(line, length));
+}
+
+// Write 'text' as one receive and commit it
+static void feed(LineAssembler& assembler, const char* text) {
+    size_t length = strlen(text);
+    TEST_ASSERT_TRUE(length <= assembler.writeSpace());
+    memcpy(assembler.writePtr(), text, length);
+    assembler.commit(length, collectLine);
+}
+
+void setUp() {
+    lines.clear();
+}
+
+void tearDown() {}
+
+void test_line_split_across_reads() {
+    LineAssembler assembler;
+    feed(assembler, "<Idle|MPos:1.000,2");
+    TEST_ASSERT_EQUAL(0, lines.size());
+    feed(assembler, ".000,3.000|FS:0,0>\r");
+    TEST_ASSERT_EQUAL(0, lines.size());
+    feed(assembler, "\n<Run|MP");
+    TEST_ASSERT_EQUAL(1, lines.size());
+    TEST_ASSERT_EQUAL_STRING("<Idle|MPos:1.000,2.000,3.000|FS:0,0>", lines[0].c_str());
+    feed(assembler, "os:4.000,5.000,6.000>\n");
+    TEST_ASSERT_EQUAL(2, lines.size());
+    TEST_ASSERT_EQUAL_STRING("<Run|MPos:4.000,5.000,6.000>", lines[1].c_str());
+}
+
+void test_several_lines_in_one_read() {
+    LineAssembler assembler;
+    feed(assembler, "ok\r\n\r\n\n[MSG:Homed]\r\nok\n");
+    TEST_ASSERT_EQUAL(3, lines.size());  // Blank lines are skipped
+    TEST_ASSERT_EQUAL_STRING("ok", lines[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("[MSG:Homed]", lines[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("ok", lines[2].c_str());
+}
+
+void test_unfinished_tail_moves_to_start() {
+    LineAssembler assembler;
+    char* start = assembler.writePtr();
+    feed(assembler, "ok\n<Jog|");
+    TEST_ASSERT_EQUAL(1, lines.size());
+
+    // Only "<Jog|" is kept, at the front of the buffer
+    TEST_ASSERT_EQUAL_PTR(start + 5, assembler.writePtr());
+    TEST_ASSERT_EQUAL(LINE_ASSEMBLER_SIZE - 5, assembler.writeSpace());
+    TEST_ASSERT_EQUAL_MEMORY("<Jog|", start, 5);
+
+    feed(assembler, "MPos:0,0,0>\n");
+    TEST_ASSERT_EQUAL(2, lines.size());
+    TEST_ASSERT_EQUAL_STRING("<Jog|MPos:0,0,0>", lines[1].c_str());
+    TEST_ASSERT_EQUAL_PTR(start, assembler.writePtr());
+}
+
+void test_oversized_line_dropped_and_counted() {
+    LineAssembler assembler;
+    std::string longLine(LINE_ASSEMBLER_SIZE, 'x');
+    feed(assembler, longLine.c_str());
+    TEST_ASSERT_EQUAL(0, lines.size());
+    TEST_ASSERT_EQUAL_UINT32(1, assembler.overflows());
+    TEST_ASSERT_EQUAL(LINE_ASSEMBLER_SIZE, assembler.writeSpace());
+
+    // The rest of the long line goes too; the next line is whole
+    feed(assembler, "xxxxxxxx\r\n<Idle>\n");
+    TEST_ASSERT_EQUAL(1, lines.size());
+    TEST_ASSERT_EQUAL_STRING("<Idle>", lines[0].c_str());
+    TEST_ASSERT_EQUAL_UINT32(1, assembler.overflows());
+}
+
+void test_line_filling_buffer_exactly_is_kept() {
+    LineAssembler assembler;
+    std::string line(LINE_ASSEMBLER_SIZE - 1, 'y');
+    line += '\n';
+    feed(assembler, line.c_str());
+    TEST_ASSERT_EQUAL(1, lines.size());
+    TEST_ASSERT_EQUAL(LINE_ASSEMBLER_SIZE - 1, lines[0].size());
+    TEST_ASSERT_EQUAL_UINT32(0, assembler.overflows());
+}
+
+void test_reset_drops_partial_line() {
+    LineAssembler assembler;
+    feed(assembler, "<Idle|MPos:");
+    assembler.reset();
+    feed(assembler, "ok\n");
+    TEST_ASSERT_EQUAL(1, lines.size());
+    TEST_ASSERT_EQUAL_STRING("ok", lines[0].c_str());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_line_split_across_reads);
+    RUN_TEST(test_several_lines_in_one_read);
+    RUN_TEST(test_unfinished_tail_moves_to_start);
+    RUN_TEST(test_oversized_line_dropped_and_counted);
+    RUN_TEST(test_line_filling_buffer_exactly_is_kept);
+    RUN_TEST(test_reset_drops_partial_line);
+    return UNITY_END();
+}
@@ -0,0 +1,224 @@
+// Golden images of the off-panel renderers (screen_snapshot.h): the built-in
+// modes' draw*Chrome/draw*Values and drawElement for JSON layouts, drawn
+// from fixed state and compared pixel for pixel with the BMPs in golden/.
+// Paths are relative to the project directory, where pio test runs.
+//
+// After an intended change to what a screen looks like, regenerate the
+// images and review them before committing:
+//     UPDATE_GOLDEN=1 pio test -e native -f test_render_golden
+// On a mismatch the render is saved as golden/<name>.actual.bmp.
+//
+// Sized elements use Font2, which the host canvas only approximates
+// (test/native/LovyanGFX.hpp) - their goldens pin layout, not glyph shapes.
+#include <unity.h>
+#include <string>
+#include "host_fakes.h"
+#include <LittleFS.h>
+#include <WiFi.h>
+#include "config/config.h"
+#include "state/global_state.h"
+#include "network/status_parser.h"
+#include "sensors/sensors.h"
+#include "utils/utils.h"
+#include "display/screen_renderer.h"
+#include "display/screen_snapshot.h"
+
+#define GOLDEN_DIR "test/test_render_golden/golden/"
+
+// Every element type, both fonts and all three alignments
+static const char TEST_LAYOUT[] = R"({
+  "name": "Golden",
+  "background": "#101820",
+  "elements": [
+    {"type": "rect", "x": 0, "y": 0, "w": 480, "h": 24, "color": "#004080", "filled": true},
+    {"type": "text", "x": 6, "y": 4, "size": 2, "color": "#FFFFFF", "label": "Golden layout"},
+    {"type": "dynamic", "x": 300, "y": 8, "size": 1, "color": "#FFFF00", "data": "rtcDateTime"},
+    {"type": "line", "x": 0, "y": 24, "w": 480, "h": 1, "color": "#808080"},
+    {"type": "line", "x": 240, "y": 30, "w": 1, "h": 130, "color": "#808080"},
+    {"type": "coord", "x": 10, "y": 30, "w": 220, "h": 40, "size": 2, "decimals": 3, "color": "#00FFFF", "label": "X ", "data": "wposX"},
+    {"type": "coord", "x": 10, "y": 75, "w": 220, "h": 40, "size": 2, "decimals": 1, "color": "#00FFFF", "label": "Y ", "data": "wposY", "align": "center"},
+    {"type": "coord", "x": 10, "y": 120, "w": 220, "h": 40, "size": 2, "decimals": 2, "color": "#00FFFF", "label": "Z ", "data": "wposZ", "align": "right"},
+    {"type": "temp", "x": 250, "y": 32, "size": 2, "decimals": 1, "color": "#FF8000", "label": "T0 ", "data": "temp0"},
+    {"type": "temp", "x": 250, "y": 56, "size": 2, "decimals": 1, "color": "#FF8000", "label": "T3 ", "data": "temp3", "showLabel": false},
+    {"type": "status", "x": 250, "y": 80, "w": 220, "h": 30, "size": 1, "color": "#FFFFFF", "label": "State: ", "data": "machineState"},
+    {"type": "dynamic", "x": 250, "y": 115, "size": 1, "color": "#C0C0C0", "label": "SSID ", "data": "ssid"},
+    {"type": "dynamic", "x": 250, "y": 130, "size": 1, "color": "#C0C0C0", "label": "IP ", "data": "ipAddress"},
+    {"type": "dynamic", "x": 250, "y": 145, "size": 1, "color": "#C0C0C0", "label": "Feed ", "data": "feedRate", "decimals": 0},
+    {"type": "rect", "x": 10, "y": 170, "w": 460, "h": 20, "color": "#00FF00", "filled": false},
+    {"type": "progress", "x": 10, "y": 196, "w": 460, "h": 12, "color": "#00FF00"},
+    {"type": "graph", "x": 10, "y": 214, "w": 460, "h": 100, "color": "#808080", "bgColor": "#000000"}
+  ]
+})";
+
+static std::string image;
+
+static void collect(const uint8_t* data, size_t length) {
+    image.append((const char*)data, length);
+}
+
+static bool readFile(const std::string& path, std::string& contents) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    char buffer[4096];
+    size_t n;
+    contents.clear();
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) contents.append(buffer, n);
+    fclose(f);
+    return true;
+}
+
+static bool writeFile(const std::string& path, const std::string& contents) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(contents.data(), 1, contents.size(), f) == contents.size();
+    return fclose(f) == 0 && ok;
+}
+
+// Compare 'image' with golden/<name>.bmp (or replace it with UPDATE_GOLDEN=1)
+static void checkGolden(const char* name) {
+    char message[160];
+    snprintf(message, sizeof(message), "%s: %u draw calls, %u pixels written",
+             name, (unsigned)lgfx::hostDrawStats.calls, (unsigned)lgfx::hostDrawStats.pixels);
+    TEST_MESSAGE(message);
+
+    TEST_ASSERT_EQUAL_UINT32(SNAPSHOT_BYTES, image.size());
+    std::string goldenPath = std::string(GOLDEN_DIR) + name + ".bmp";
+    std::string actualPath = std::string(GOLDEN_DIR) + name + ".actual.bmp";
+
+    const char* update = getenv("UPDATE_GOLDEN");
+    if (update != nullptr && strcmp(update, "1") == 0) {
+        TEST_ASSERT_TRUE_MESSAGE(writeFile(goldenPath, image), goldenPath.c_str());
+        remove(actualPath.c_str());
+        return;
+    }
+
+    std::string golden;
+    if (!readFile(goldenPath, golden)) {
+        snprintf(message, sizeof(message), "No %s - run with UPDATE_GOLDEN=1", goldenPath.c_str());
+        TEST_FAIL_MESSAGE(message);
+    }
+    if (golden == image) {
+        remove(actualPath.c_str());
+        return;
+    }
+
+    writeFile(actualPath, image);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(SNAPSHOT_BYTES, golden.size(), "Golden is not a full snapshot");
+    uint32_t differing = 0;
+    int firstX = -1, firstY = -1;
+    for (uint32_t i = SNAPSHOT_HEADER_BYTES; i < SNAPSHOT_BYTES; i += 2) {
+        if (golden.compare(i, 2, image, i, 2) == 0) continue;
+        if (differing++ == 0) {
+            firstX = (i - SNAPSHOT_HEADER_BYTES) / 2 % SCREEN_WIDTH;
+            firstY = (i - SNAPSHOT_HEADER_BYTES) / 2 / SCREEN_WIDTH;
+        }
+    }
+    snprintf(message, sizeof(message), "%u pixels differ, first at (%d, %d) - see %s",
+             (unsigned)differing, firstX, firstY, actualPath.c_str());
+    TEST_FAIL_MESSAGE(message);
+}
+
+// Machine, sensors, network and history every render starts from
+static void setupState() {
+    loadConfig();
+    initGlobalState();
+    storage.begin();
+    network.rtcAvailable = true;
+    WiFi.hostConnect("workshop", IPAddress(192, 168, 1, 50), -58);
+
+    const float temps[4] = {31.5f, 28.25f, 45.0f, 52.75f};
+    for (int i = 0; i < 4; i++) {
+        sensors.temperatures[i] = temps[i];
+        sensors.peakTemps[i] = temps[i] + 4.0f;
+    }
+    sensors.psuVoltage = 24.1f;
+    sensors.psuMin = 23.8f;
+    sensors.psuMax = 24.3f;
+    sensors.fanSpeed = 60;
+    sensors.fanRPM = 1800;
+    publishSensorState();
+    refreshSensorsView();
+
+    SensorMapping spindle;
+    memset(&spindle, 0, sizeof(spindle));
+    strlcpy(spindle.friendlyName, "Spindle", sizeof(spindle.friendlyName));
+    spindle.enabled = true;
+    spindle.displayPosition = 0;
+    sensorMappings.push_back(spindle);
+
+    static const char report[] =
+        "<Run|MPos:125.500,-40.250,-3.125,0.000|FS:1200,12000|WCO:10.000,20.000,-1.000,0.000>";
+    parseFluidNCStatus(report, strlen(report));
+    fluidnc.connected = true;
+
+    // Integer ramps only, so every libm draws the same graph
+    allocateHistoryBuffer();
+    for (uint16_t i = 0; i < history.historySize; i++) {
+        history.tempHistory[i] = 20.0f + (float)((i * 7) % 300) / 10.0f;
+    }
+    history.historyIndex = 0;
+    history.sampleCount = history.historySize;
+}
+
+void setUp() {
+    hostSetMillis(3723000);     // Uptime 1:02:03
+    image.clear();
+    lgfx::hostDrawStats.calls = 0;
+    lgfx::hostDrawStats.pixels = 0;
+}
+
+void tearDown() {}
+
+void test_monitor_mode() {
+    TEST_ASSERT_TRUE(snapshotMode(MODE_MONITOR, collect));
+    checkGolden("monitor");
+}
+
+void test_alignment_mode() {
+    TEST_ASSERT_TRUE(snapshotMode(MODE_ALIGNMENT, collect));
+    checkGolden("alignment");
+}
+
+void test_graph_mode() {
+    TEST_ASSERT_TRUE(snapshotMode(MODE_GRAPH, collect));
+    checkGolden("graph");
+}
+
+void test_builtin_dro_layout() {
+    ScreenLayout layout = {};
+    TEST_ASSERT_TRUE(loadScreenConfig(DRO_SCREEN_PATH, layout));
+    TEST_ASSERT_TRUE(snapshotLayout(layout, collect));
+    freeScreenLayout(layout);
+    checkGolden("dro");
+}
+
+void test_json_layout() {
+    LittleFS.hostWrite("/screens/golden.json", TEST_LAYOUT);
+    ScreenLayout layout = {};
+    TEST_ASSERT_TRUE(loadScreenConfig("/screens/golden.json", layout));
+    TEST_ASSERT_EQUAL(17, layout.elementCount);
+    TEST_ASSERT_TRUE(snapshotLayout(layout, collect));
+    freeScreenLayout(layout);
+    checkGolden("layout");
+}
+
+void test_snapshot_is_repeatable() {
+    TEST_ASSERT_TRUE(snapshotMode(MODE_MONITOR, collect));
+    std::string first = image;
+    image.clear();
+    hostAdvanceMillis(5000);
+    TEST_ASSERT_TRUE(snapshotMode(MODE_MONITOR, collect));
+    TEST_ASSERT_TRUE(first == image);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    setupState();
+    RUN_TEST(test_monitor_mode);
+    RUN_TEST(test_alignment_mode);
+    RUN_TEST(test_graph_mode);
+    RUN_TEST(test_builtin_dro_layout);
+    RUN_TEST(test_json_layout);
+    RUN_TEST(test_snapshot_is_repeatable);
+    return UNITY_END();
+}
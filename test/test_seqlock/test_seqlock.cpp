@@ -0,0 +1,113 @@
+// Seqlock: a reader racing a writer on another thread never sees a torn copy
+#include <unity.h>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include "utils/seqlock.h"
+
+#define SNAPSHOT_WORDS  1024        // 4 KB: long enough copies that they overlap writes
+#define READS           50000       // Consistent copies each reader test takes
+
+// Every word carries the same generation, so a mixed copy is a torn read
+struct Snapshot {
+    uint32_t words[SNAPSHOT_WORDS];
+};
+
+static void fill(Snapshot& snapshot, uint32_t generation) {
+    for (int i = 0; i < SNAPSHOT_WORDS; i++) snapshot.words[i] = generation;
+}
+
+static bool consistent(const Snapshot& snapshot) {
+    for (int i = 1; i < SNAPSHOT_WORDS; i++) {
+        if (snapshot.words[i] != snapshot.words[0]) return false;
+    }
+    return true;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_single_thread_round_trip() {
+    Seqlock<Snapshot> lock;
+    Snapshot in, out;
+    TEST_ASSERT_EQUAL_UINT32(0, lock.sequence());
+
+    fill(in, 7);
+    lock.write(in);
+    TEST_ASSERT_EQUAL_UINT32(2, lock.sequence());  // Even: no write in progress
+    TEST_ASSERT_TRUE(lock.tryRead(out));
+    TEST_ASSERT_EQUAL_MEMORY(&in, &out, sizeof(Snapshot));
+}
+
+// Writes ever newer generations until told to stop
+static void writeUntil(Seqlock<Snapshot>& lock, const std::atomic<bool>& stop) {
+    Snapshot value;
+    uint32_t generation = 0;
+    while (!stop.load()) {
+        fill(value, ++generation);
+        lock.write(value);
+    }
+}
+
+void test_reader_never_sees_torn_write() {
+    Seqlock<Snapshot> lock;
+    std::atomic<bool> stop(false);
+    std::thread writer(writeUntil, std::ref(lock), std::cref(stop));
+
+    uint32_t reads = 0;
+    uint32_t retries = 0;
+    uint32_t torn = 0;
+    uint32_t wentBack = 0;
+    uint32_t lastGeneration = 0;
+    Snapshot copy;
+    while (reads < READS) {
+        if (!lock.tryRead(copy)) {
+            retries++;              // Overlapped a write - read() would retry
+            continue;
+        }
+        reads++;
+        if (!consistent(copy)) torn++;
+        if (copy.words[0] < lastGeneration) wentBack++;
+        lastGeneration = copy.words[0];
+    }
+    stop.store(true);
+    writer.join();
+
+    char summary[64];
+    snprintf(summary, sizeof(summary), "%lu reads, %lu retried",
+             (unsigned long)reads, (unsigned long)retries);
+    TEST_MESSAGE(summary);
+
+    TEST_ASSERT_EQUAL_UINT32(0, torn);
+    TEST_ASSERT_EQUAL_UINT32(0, wentBack);
+
+    // Quiet again: the last write is what a read returns
+    lock.read(copy);
+    TEST_ASSERT_TRUE(consistent(copy));
+    TEST_ASSERT_EQUAL_UINT32(lock.sequence() / 2, copy.words[0]);
+}
+
+void test_blocking_read_under_contention() {
+    Seqlock<Snapshot> lock;
+    std::atomic<bool> stop(false);
+    std::thread writer(writeUntil, std::ref(lock), std::cref(stop));
+
+    uint32_t torn = 0;
+    Snapshot copy;
+    for (uint32_t i = 0; i < READS; i++) {
+        lock.read(copy);
+        if (!consistent(copy)) torn++;
+    }
+    stop.store(true);
+    writer.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, torn);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_single_thread_round_trip);
+    RUN_TEST(test_reader_never_sees_torn_write);
+    RUN_TEST(test_blocking_read_under_contention);
+    return UNITY_END();
+}
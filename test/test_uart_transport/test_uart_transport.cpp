@@ -0,0 +1,150 @@
+// UartTransport on a pre-opened Stream: reassembly, noise and resync
+#include <unity.h>
+#include <string>
+#include "host_fakes.h"
+#include "network/uart_transport.h"
+
+// Bytes queued by the test stand in for the controller's console
+class ScriptedStream : public Stream {
+public:
+    ScriptedStream() : _pos(0) {}
+
+    void push(const char* bytes, size_t length) { _rx.append(bytes, length); }
+    void push(const char* text) { push(text, strlen(text)); }
+    const std::string& sent() const { return _tx; }
+
+    int available() { return (int)(_rx.size() - _pos); }
+    int read() { return _pos < _rx.size() ? (uint8_t)_rx[_pos++] : -1; }
+    int peek() { return _pos < _rx.size() ? (uint8_t)_rx[_pos] : -1; }
+    size_t write(uint8_t c) { _tx += (char)c; return 1; }
+    using Print::write;
+
+private:
+    std::string _rx;
+    size_t _pos;
+    std::string _tx;
+};
+
+static ScriptedStream* console;
+static UartTransport* transport;
+static uint32_t framingBefore;
+static uint32_t resyncsBefore;
+
+// Queue 'text' and let the transport drain it
+static void receive(const char* text) {
+    console->push(text);
+    transport->loop();
+}
+
+void setUp() {
+    hostSetMillis(1000);
+    hostResetTransport();
+    console = new ScriptedStream();
+    transport = new UartTransport(*console);
+    transport->begin(nullptr);
+    framingBefore = transport->framingErrors();   // Counters are per process
+    resyncsBefore = transport->resyncs();
+}
+
+void tearDown() {
+    transport->end();
+    delete transport;
+    delete console;
+}
+
+void test_begin_connects_and_drops_stale_bytes() {
+    ScriptedStream stale;
+    stale.push("us:0,0,0>\r\n");
+    UartTransport late(stale);
+    hostResetTransport();
+    late.begin(nullptr);
+    TEST_ASSERT_EQUAL(1, hostTransport.connected);
+
+    late.loop();
+    TEST_ASSERT_EQUAL(0, hostTransport.messages.size());
+    late.end();
+    TEST_ASSERT_EQUAL(1, hostTransport.disconnected);
+}
+
+void test_report_split_across_reads() {
+    receive("<Idle|MPos:1.0");
+    receive("00,2.000,3.0");
+    TEST_ASSERT_EQUAL(0, hostTransport.messages.size());
+    receive("00|FS:0,0>\r\n<Jog|MPos:4");
+    TEST_ASSERT_EQUAL(1, hostTransport.messages.size());
+    TEST_ASSERT_EQUAL_STRING("<Idle|MPos:1.000,2.000,3.000|FS:0,0>",
+                             hostTransport.messages[0].c_str());
+    receive(".000,0.000,0.000>\r\n");
+    TEST_ASSERT_EQUAL(2, hostTransport.messages.size());
+    TEST_ASSERT_EQUAL_STRING("<Jog|MPos:4.000,0.000,0.000>", hostTransport.messages[1].c_str());
+
+    TEST_ASSERT_EQUAL_UINT32(framingBefore, transport->framingErrors());
+    TEST_ASSERT_EQUAL_UINT32(resyncsBefore, transport->resyncs());
+}
+
+void test_noise_before_report_is_skipped() {
+    // Baud-rate garbage from a controller reset, then a clean report
+    static const char noise[] = "\xff\x00\x1b\xfe<Idle|MPos:0.000,0.000,0.000>\r\n";
+    console->push(noise, sizeof(noise) - 1);
+    transport->loop();
+
+    TEST_ASSERT_EQUAL(1, hostTransport.messages.size());
+    TEST_ASSERT_EQUAL_STRING("<Idle|MPos:0.000,0.000,0.000>", hostTransport.messages[0].c_str());
+    TEST_ASSERT_EQUAL_UINT32(resyncsBefore + 1, transport->resyncs());
+    TEST_ASSERT_EQUAL_UINT32(framingBefore, transport->framingErrors());
+}
+
+void test_noise_line_counts_framing_error() {
+    static const char noise[] = "ok\x07\x80\r\n<Idle\x01|MPos:0,0,0>\n";
+    console->push(noise, sizeof(noise) - 1);
+    transport->loop();
+
+    TEST_ASSERT_EQUAL(0, hostTransport.messages.size());
+    TEST_ASSERT_EQUAL_UINT32(framingBefore + 2, transport->framingErrors());
+    TEST_ASSERT_EQUAL_UINT32(resyncsBefore, transport->resyncs());
+
+    receive("ok\r\n");
+    TEST_ASSERT_EQUAL(1, hostTransport.messages.size());
+    TEST_ASSERT_EQUAL_STRING("ok", hostTransport.messages[0].c_str());
+}
+
+void test_mid_line_report_start_resyncs() {
+    // A report cut off by a controller reset runs into the next one
+    receive("<Run|MPos:12.5");
+    receive("00,3<Idle|MPos:0.000,0.000,0.000|FS:0,0>\r\n");
+
+    TEST_ASSERT_EQUAL(1, hostTransport.messages.size());
+    TEST_ASSERT_EQUAL_STRING("<Idle|MPos:0.000,0.000,0.000|FS:0,0>",
+                             hostTransport.messages[0].c_str());
+    TEST_ASSERT_EQUAL_UINT32(resyncsBefore + 1, transport->resyncs());
+    TEST_ASSERT_EQUAL_UINT32(framingBefore, transport->framingErrors());
+}
+
+void test_silence_reports_disconnect() {
+    receive("<Idle|MPos:0,0,0>\n");
+    hostAdvanceMillis(UART_SILENCE_TIMEOUT - 1);
+    transport->loop();
+    TEST_ASSERT_EQUAL(0, hostTransport.disconnected);
+
+    hostAdvanceMillis(1);
+    transport->loop();
+    TEST_ASSERT_EQUAL(1, hostTransport.disconnected);
+}
+
+void test_send_writes_to_stream() {
+    TEST_ASSERT_TRUE(transport->send("?"));
+    TEST_ASSERT_TRUE(transport->send("$Report/Interval=200\n"));
+    TEST_ASSERT_EQUAL_STRING("?$Report/Interval=200\n", console->sent().c_str());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_begin_connects_and_drops_stale_bytes);
+    RUN_TEST(test_report_split_across_reads);
+    RUN_TEST(test_noise_before_report_is_skipped);
+    RUN_TEST(test_noise_line_counts_framing_error);
+    RUN_TEST(test_mid_line_report_start_resyncs);
+    RUN_TEST(test_silence_reports_disconnect);
+    RUN_TEST(test_send_writes_to_stream);
+    return UNITY_END();
+}